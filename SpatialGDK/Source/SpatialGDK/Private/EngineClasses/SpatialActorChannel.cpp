@@ -26,6 +26,7 @@
 #include "SpatialGDKSettings.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialActorUtils.h"
+#include "Utils/SpatialTracer.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialActorChannel);
 
@@ -80,6 +81,10 @@ USpatialActorChannel::USpatialActorChannel(const FObjectInitializer& ObjectIniti
 	, EntityId(SpatialConstants::INVALID_ENTITY_ID)
 	, bInterestDirty(false)
 	, bNetOwned(false)
+	, bConditionMapFilterValid(false)
+	, bConditionMapNetOwner(false)
+	, bConditionMapNetSimulated(false)
+	, bConditionMapRepPhysics(false)
 	, NetDriver(nullptr)
 	, LastPositionSinceUpdate(FVector::ZeroVector)
 	, TimeWhenPositionLastUpdated(0.0f)
@@ -290,6 +295,7 @@ FHandoverChangeState USpatialActorChannel::CreateInitialHandoverChangeState(cons
 int64 USpatialActorChannel::ReplicateActor()
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialActorChannelReplicateActor);
+	FSpatialTraceScope ReplicateActorTrace(ESpatialTraceEvent::ReplicateActor, EntityId);
 
 	if (!IsReadyForReplication())
 	{
@@ -785,6 +791,7 @@ FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(TArray<uint8>&
 void USpatialActorChannel::SetChannelActor(AActor* InActor)
 {
 	Super::SetChannelActor(InActor);
+	InvalidateConditionMapFilter();
 	
 	USpatialPackageMapClient* PackageMap = NetDriver->PackageMap;
 	EntityId = PackageMap->GetEntityIdFromObject(InActor);
@@ -841,7 +848,7 @@ bool USpatialActorChannel::TryResolveActor()
 	// If a Singleton was created, update the GSM with the proper Id.
 	if (Actor->GetClass()->HasAnySpatialClassFlags(SPATIALCLASS_Singleton))
 	{
-		NetDriver->GlobalStateManager->UpdateSingletonEntityId(Actor->GetClass()->GetPathName(), EntityId);
+		NetDriver->GlobalStateManager->UpdateSingletonEntityId(Actor->GetClass(), EntityId);
 	}
 
 	// Inform USpatialNetDriver of this new actor channel/entity pairing
@@ -1063,6 +1070,28 @@ void USpatialActorChannel::UpdateEntityACLToNewOwner()
 	}
 }
 
+const FSpatialConditionMapFilter& USpatialActorChannel::GetConditionMapFilter(bool bIsClient)
+{
+	const bool bNetSimulated = Actor->Role == ROLE_SimulatedProxy;
+	const bool bRepPhysics = Actor->ReplicatedMovement.bRepPhysics;
+
+	if (!bConditionMapFilterValid)
+	{
+		bConditionMapNetOwner = bIsClient && IsOwnedByWorker();
+	}
+	else if (bNetSimulated == bConditionMapNetSimulated && bRepPhysics == bConditionMapRepPhysics)
+	{
+		return ConditionMapFilter;
+	}
+
+	bConditionMapNetSimulated = bNetSimulated;
+	bConditionMapRepPhysics = bRepPhysics;
+	bConditionMapFilterValid = true;
+
+	ConditionMapFilter = FSpatialConditionMapFilter(bConditionMapNetSimulated, bConditionMapNetOwner, bConditionMapRepPhysics);
+	return ConditionMapFilter;
+}
+
 void USpatialActorChannel::ClientProcessOwnershipChange(bool bNewNetOwned)
 {
 	if (bNewNetOwned != bNetOwned)
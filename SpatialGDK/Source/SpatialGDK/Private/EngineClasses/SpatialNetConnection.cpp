@@ -2,8 +2,6 @@
 
 #include "EngineClasses/SpatialNetConnection.h"
 
-#include "TimerManager.h"
-
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "Gameframework/PlayerController.h"
@@ -13,6 +11,7 @@
 #include "Interop/SpatialSender.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/TimingWheel.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 
@@ -127,37 +126,22 @@ void USpatialNetConnection::ClientNotifyClientHasQuit()
 	}
 }
 
-void USpatialNetConnection::InitHeartbeat(FTimerManager* InTimerManager, Worker_EntityId InPlayerControllerEntity)
+void USpatialNetConnection::InitHeartbeat(FTimingWheel* InTimingWheel, Worker_EntityId InPlayerControllerEntity)
 {
 	checkf(PlayerControllerEntity == SpatialConstants::INVALID_ENTITY_ID, TEXT("InitHeartbeat: PlayerControllerEntity already set: %lld. New entity: %lld"), PlayerControllerEntity, InPlayerControllerEntity);
 	PlayerControllerEntity = InPlayerControllerEntity;
-	TimerManager = InTimerManager;
+	TimingWheel = InTimingWheel;
 
-	if (Driver->IsServer())
-	{
-		SetHeartbeatTimeoutTimer();
-	}
-	else
+	// Servers track heartbeat timeouts for all of their connections at once in USpatialReceiver.
+	if (!Driver->IsServer())
 	{
 		SetHeartbeatEventTimer();
 	}
 }
 
-void USpatialNetConnection::SetHeartbeatTimeoutTimer()
-{
-	TimerManager->SetTimer(HeartbeatTimer, [WeakThis = TWeakObjectPtr<USpatialNetConnection>(this)]()
-	{
-		if (USpatialNetConnection* Connection = WeakThis.Get())
-		{
-			// This client timed out. Disconnect it and trigger OnDisconnected logic.
-			Connection->CleanUp();
-		}
-	}, GetDefault<USpatialGDKSettings>()->HeartbeatTimeoutSeconds, false);
-}
-
 void USpatialNetConnection::SetHeartbeatEventTimer()
 {
-	TimerManager->SetTimer(HeartbeatTimer, [WeakThis = TWeakObjectPtr<USpatialNetConnection>(this)]()
+	TimingWheel->SetTimer(HeartbeatTimer, [WeakThis = TWeakObjectPtr<USpatialNetConnection>(this)]()
 	{
 		if (USpatialNetConnection* Connection = WeakThis.Get())
 		{
@@ -180,14 +164,9 @@ void USpatialNetConnection::SetHeartbeatEventTimer()
 void USpatialNetConnection::DisableHeartbeat()
 {
 	// Remove the heartbeat callback
-	if (TimerManager != nullptr && HeartbeatTimer.IsValid())
+	if (TimingWheel != nullptr && HeartbeatTimer.IsValid())
 	{
-		TimerManager->ClearTimer(HeartbeatTimer);
+		TimingWheel->ClearTimer(HeartbeatTimer);
 	}
 	PlayerControllerEntity = SpatialConstants::INVALID_ENTITY_ID;
 }
-
-void USpatialNetConnection::OnHeartbeat()
-{
-	SetHeartbeatTimeoutTimer();
-}
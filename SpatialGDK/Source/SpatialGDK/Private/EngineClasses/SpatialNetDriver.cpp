@@ -283,6 +283,8 @@ void USpatialNetDriver::CreateAndInitializeCoreClasses()
 {
 	InitializeSpatialOutputDevice();
 
+	Connection->SetCounters(&Counters);
+
 	Dispatcher = NewObject<USpatialDispatcher>();
 	Sender = NewObject<USpatialSender>();
 	Receiver = NewObject<USpatialReceiver>();
@@ -304,7 +306,7 @@ void USpatialNetDriver::CreateAndInitializeCoreClasses()
 	PackageMap->Init(this);
 	Dispatcher->Init(this);
 	Sender->Init(this, &TimerManager);
-	Receiver->Init(this, &TimerManager);
+	Receiver->Init(this, &TimingWheel);
 	GlobalStateManager->Init(this, &TimerManager);
 	SnapshotManager->Init(this);
 	PlayerSpawner->Init(this, &TimerManager);
@@ -313,7 +315,7 @@ void USpatialNetDriver::CreateAndInitializeCoreClasses()
 	// Entity Pools should never exist on clients
 	if (IsServer())
 	{
-		EntityPool->Init(this, &TimerManager);
+		EntityPool->Init(this, &TimingWheel);
 	}
 }
 
@@ -564,12 +566,24 @@ void USpatialNetDriver::BeginDestroy()
 {
 	Super::BeginDestroy();
 
+	// Let clients waiting to be accepted retry with another server, rather than waiting for their requests to time out.
+	if (Connection != nullptr && PlayerSpawner != nullptr && PlayerSpawner->GetNumPendingPlayerSpawns() > 0)
+	{
+		PlayerSpawner->FailPendingPlayerSpawns(SpatialConstants::INVALID_ENTITY_ID, TEXT("The server shut down before the player was accepted."));
+	}
+
 	// If we are still connected, cleanup our corresponding worker entity if it exists.
 	if (Connection != nullptr && WorkerEntityId != SpatialConstants::INVALID_ENTITY_ID)
 	{
 		Connection->SendDeleteEntityRequest(WorkerEntityId);
 	}
 
+	// The connection can outlive this net driver, so stop it from counting into our counters.
+	if (Connection != nullptr && Connection->GetCounters() == &Counters)
+	{
+		Connection->SetCounters(nullptr);
+	}
+
 #if WITH_EDITOR
 	// Ensure our OnDeploymentStart delegate is removed when the net driver is shut down.
 	if (FSpatialGDKServicesModule* GDKServices = FModuleManager::GetModulePtr<FSpatialGDKServicesModule>("SpatialGDKServices"))
@@ -1218,20 +1232,42 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 
 	if (Connection != nullptr)
 	{
-		TArray<Worker_OpList*> OpLists = Connection->GetOpList();
+		TArray<SpatialGDK::FPreDecodedOpList> OpLists = Connection->GetOpList();
 
 		// Servers will queue ops at startup until we've extracted necessary information from the op stream
 		if (!bIsReadyToStart)
 		{
-			HandleStartupOpQueueing(OpLists);
+			// Queued startup ops are decoded again on the game thread when they're finally dispatched.
+			TArray<Worker_OpList*> RawOpLists;
+			for (const SpatialGDK::FPreDecodedOpList& OpList : OpLists)
+			{
+				RawOpLists.Add(OpList.OpList);
+			}
+
+			HandleStartupOpQueueing(RawOpLists);
 			return;
 		}
 
-		for (Worker_OpList* OpList : OpLists)
+		const uint32 ReceiveStartCycles = FPlatformTime::Cycles();
+
+		for (SpatialGDK::FPreDecodedOpList& OpList : OpLists)
 		{
 			Dispatcher->ProcessOps(OpList);
 
-			Worker_OpList_Destroy(OpList);
+			Worker_OpList_Destroy(OpList.OpList);
+		}
+
+		Receiver->ProcessCompletedClassLoads();
+		Receiver->ProcessQueuedSpawns();
+
+		if (IsServer())
+		{
+			PlayerSpawner->ProcessPendingPlayerSpawns();
+		}
+
+		if (SpatialMetrics != nullptr)
+		{
+			SpatialMetrics->GetLoadEstimator().AddReceiveTime(FPlatformTime::ToSeconds(FPlatformTime::Cycles() - ReceiveStartCycles));
 		}
 
 		if (SpatialMetrics != nullptr && GetDefault<USpatialGDKSettings>()->bEnableMetrics)
@@ -1326,6 +1362,8 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 	// Super::TickFlush() will not call ReplicateActors() because Spatial connections have InternalAck set to true.
 	// In our case, our Spatial actor interop is triggered through ReplicateActors() so we want to call it regardless.
 
+	const uint32 ReplicationStartCycles = FPlatformTime::Cycles();
+
 #if USE_SERVER_PERF_COUNTERS
 	double ServerReplicateActorsTimeMs = 0.0f;
 #endif // USE_SERVER_PERF_COUNTERS
@@ -1339,8 +1377,12 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 		double ServerReplicateActorsTimeStart = FPlatformTime::Seconds();
 #endif // USE_SERVER_PERF_COUNTERS
 
+		const uint32 ReplicateActorsStartCycles = FPlatformTime::Cycles();
+
 		int32 Updated = ServerReplicateActors(DeltaTime);
 
+		Counters.RecordReplicationTime(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles() - ReplicateActorsStartCycles));
+
 #if USE_SERVER_PERF_COUNTERS
 		ServerReplicateActorsTimeMs = (FPlatformTime::Seconds() - ServerReplicateActorsTimeStart) * 1000.0;
 #endif // USE_SERVER_PERF_COUNTERS
@@ -1373,9 +1415,31 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 		Sender->FlushPackedRPCs();
 	}
 
-	// Tick the timer manager
+	if (GetDefault<USpatialGDKSettings>()->bUseRingBufferForCrossServerRPCs && IsServer() && Sender != nullptr)
+	{
+		Sender->FlushCrossServerRPCs();
+		Receiver->FlushCrossServerRPCAcks();
+	}
+
+	if (IsServer() && Receiver != nullptr)
+	{
+		Receiver->CheckHeartbeatTimeouts();
+	}
+
+	if (IsServer() && GlobalStateManager != nullptr)
+	{
+		GlobalStateManager->FlushSingletonManagerUpdates();
+	}
+
+	if (SpatialMetrics != nullptr)
+	{
+		SpatialMetrics->GetLoadEstimator().AddReplicationTime(FPlatformTime::ToSeconds(FPlatformTime::Cycles() - ReplicationStartCycles));
+	}
+
+	// Tick the timer manager and timing wheel
 	{
 		TimerManager.Tick(DeltaTime);
+		TimingWheel.Tick(DeltaTime);
 	}
 
 	Super::TickFlush(DeltaTime);
@@ -1827,11 +1891,11 @@ void USpatialNetDriver::OnRPCAuthorityGained(AActor* Actor, ESchemaComponentType
 
 void USpatialNetDriver::DelayedSendDeleteEntityRequest(Worker_EntityId EntityId, float Delay)
 {
-	FTimerHandle RetryTimer;
-	TimerManager.SetTimer(RetryTimer, [this, EntityId]()
+	FTimingWheelHandle RetryTimer;
+	TimingWheel.SetTimer(RetryTimer, [this, EntityId]()
 	{
 		Sender->SendDeleteEntityRequest(EntityId);
-	}, Delay, false);
+	}, Delay);
 }
 
 void USpatialNetDriver::HandleStartupOpQueueing(const TArray<Worker_OpList*>& InOpLists)
@@ -0,0 +1,197 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/LogMessageBuffer.h"
+
+namespace SpatialGDK
+{
+
+static_assert((FLogMessageBuffer::CAPACITY & (FLogMessageBuffer::CAPACITY - 1)) == 0, "FLogMessageBuffer::CAPACITY must be a power of two");
+
+namespace
+{
+// Appended to messages longer than MAX_OVERFLOW_MESSAGE_BYTES, after an ellipsis.
+const ANSICHAR TRUNCATION_MARKER_FORMAT[] = "\xE2\x80\xA6[truncated %d bytes]";
+const int32 MAX_TRUNCATION_MARKER_BYTES = 40;
+
+// Encodes Source as UTF-8 straight into Dest, stopping before the first character that doesn't fit in MaxBytes.
+// FTCHARToUTF8 would allocate for anything longer than its inline buffer. Returns the number of bytes written, and
+// sets bOutComplete to whether all of Source fit.
+int32 ConvertToTruncatedUTF8(const TCHAR* Source, ANSICHAR* Dest, int32 MaxBytes, bool& bOutComplete)
+{
+	bOutComplete = false;
+	int32 Length = 0;
+	while (*Source != 0)
+	{
+		uint32 CodePoint = static_cast<uint32>(*Source++);
+
+		// Where TCHAR is UTF-16, characters outside the basic plane are split over a surrogate pair.
+		if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && static_cast<uint32>(*Source) >= 0xDC00 && static_cast<uint32>(*Source) <= 0xDFFF)
+		{
+			CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (static_cast<uint32>(*Source++) - 0xDC00);
+		}
+		else if ((CodePoint >= 0xD800 && CodePoint <= 0xDFFF) || CodePoint > 0x10FFFF)
+		{
+			CodePoint = '?';
+		}
+
+		const int32 NumBytes = CodePoint < 0x80 ? 1 : CodePoint < 0x800 ? 2 : CodePoint < 0x10000 ? 3 : 4;
+		if (Length + NumBytes > MaxBytes)
+		{
+			break;
+		}
+
+		ANSICHAR* Out = Dest + Length;
+		switch (NumBytes)
+		{
+		case 1:
+			Out[0] = static_cast<ANSICHAR>(CodePoint);
+			break;
+		case 2:
+			Out[0] = static_cast<ANSICHAR>(0xC0 | (CodePoint >> 6));
+			Out[1] = static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F));
+			break;
+		case 3:
+			Out[0] = static_cast<ANSICHAR>(0xE0 | (CodePoint >> 12));
+			Out[1] = static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F));
+			Out[2] = static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F));
+			break;
+		default:
+			Out[0] = static_cast<ANSICHAR>(0xF0 | (CodePoint >> 18));
+			Out[1] = static_cast<ANSICHAR>(0x80 | ((CodePoint >> 12) & 0x3F));
+			Out[2] = static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F));
+			Out[3] = static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F));
+			break;
+		}
+		Length += NumBytes;
+	}
+	bOutComplete = true;
+	return Length;
+}
+
+// Copies a message too long for a slot into OutMessage, cutting it short on a character boundary with a marker
+// if it's longer than MAX_OVERFLOW_MESSAGE_BYTES. Returns the length of the copy.
+int32 CopyOverflowMessage(const TCHAR* Message, TArray<ANSICHAR>& OutMessage)
+{
+	const FTCHARToUTF8 Converted(Message);
+	const int32 FullLength = Converted.Length();
+
+	if (FullLength <= FBufferedLogMessage::MAX_OVERFLOW_MESSAGE_BYTES)
+	{
+		OutMessage.SetNumUninitialized(FullLength + 1);
+		FMemory::Memcpy(OutMessage.GetData(), Converted.Get(), FullLength);
+		OutMessage[FullLength] = '\0';
+		return FullLength;
+	}
+
+	// Continuation bytes start with 10 in binary, back up to the start of the character that was cut.
+	int32 KeptLength = FBufferedLogMessage::MAX_OVERFLOW_MESSAGE_BYTES - MAX_TRUNCATION_MARKER_BYTES;
+	while (KeptLength > 0 && (static_cast<uint8>(Converted.Get()[KeptLength]) & 0xC0) == 0x80)
+	{
+		KeptLength--;
+	}
+
+	OutMessage.SetNumUninitialized(KeptLength + MAX_TRUNCATION_MARKER_BYTES + 1);
+	FMemory::Memcpy(OutMessage.GetData(), Converted.Get(), KeptLength);
+	const int32 MarkerLength = FCStringAnsi::Snprintf(OutMessage.GetData() + KeptLength, MAX_TRUNCATION_MARKER_BYTES + 1, TRUNCATION_MARKER_FORMAT, FullLength - KeptLength);
+
+	const int32 Length = KeptLength + FMath::Clamp(MarkerLength, 0, MAX_TRUNCATION_MARKER_BYTES);
+	OutMessage.SetNum(Length + 1, false);
+	OutMessage[Length] = '\0';
+	return Length;
+}
+}
+
+FLogMessageBuffer::FLogMessageBuffer()
+	: EnqueuePosition(0)
+	, DequeuePosition(0)
+	, NumDropped(0)
+{
+	Slots.SetNum(CAPACITY);
+	for (uint32 i = 0; i < CAPACITY; i++)
+	{
+		Slots[i].Sequence = static_cast<int32>(i);
+	}
+}
+
+bool FLogMessageBuffer::Push(uint8 Level, const FName& LoggerName, const TCHAR* Message)
+{
+	// Positions wrap around, so they are compared through the difference as unsigned values.
+	uint32 Position = static_cast<uint32>(FPlatformAtomics::AtomicRead(&EnqueuePosition));
+	FSlot* Slot = nullptr;
+
+	for (;;)
+	{
+		Slot = &Slots[Position & (CAPACITY - 1)];
+		const uint32 Sequence = static_cast<uint32>(FPlatformAtomics::AtomicRead(&Slot->Sequence));
+		const int32 Difference = static_cast<int32>(Sequence - Position);
+
+		if (Difference == 0)
+		{
+			const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(&EnqueuePosition, static_cast<int32>(Position + 1), static_cast<int32>(Position));
+			if (static_cast<uint32>(Previous) == Position)
+			{
+				break;
+			}
+			Position = static_cast<uint32>(Previous);
+		}
+		else if (Difference < 0)
+		{
+			// The consumer hasn't freed this slot yet, so the buffer is full.
+			FPlatformAtomics::InterlockedIncrement(&NumDropped);
+			return false;
+		}
+		else
+		{
+			// Another producer claimed this position first.
+			Position = static_cast<uint32>(FPlatformAtomics::AtomicRead(&EnqueuePosition));
+		}
+	}
+
+	FBufferedLogMessage& Data = Slot->Data;
+	Data.Level = Level;
+	Data.LoggerName = LoggerName;
+
+	bool bComplete = false;
+	int32 Length = ConvertToTruncatedUTF8(Message, Data.Message, FBufferedLogMessage::MAX_MESSAGE_BYTES, bComplete);
+	Data.Message[Length] = '\0';
+	if (!bComplete)
+	{
+		Length = CopyOverflowMessage(Message, Data.OverflowMessage);
+	}
+	Data.Length = Length;
+
+	// Publishes the message to the consumer, the exchange is a full barrier.
+	FPlatformAtomics::InterlockedExchange(&Slot->Sequence, static_cast<int32>(Position + 1));
+	return true;
+}
+
+bool FLogMessageBuffer::Pop(FBufferedLogMessage& OutMessage)
+{
+	FSlot& Slot = Slots[DequeuePosition & (CAPACITY - 1)];
+	const uint32 Sequence = static_cast<uint32>(FPlatformAtomics::AtomicRead(&Slot.Sequence));
+	if (static_cast<int32>(Sequence - (DequeuePosition + 1)) < 0)
+	{
+		return false;
+	}
+
+	OutMessage.Level = Slot.Data.Level;
+	OutMessage.LoggerName = Slot.Data.LoggerName;
+	OutMessage.Length = Slot.Data.Length;
+	if (Slot.Data.OverflowMessage.Num() > 0)
+	{
+		// Moving out leaves the slot without an overflow allocation for the next message.
+		OutMessage.OverflowMessage = MoveTemp(Slot.Data.OverflowMessage);
+	}
+	else
+	{
+		OutMessage.OverflowMessage.Reset();
+		FMemory::Memcpy(OutMessage.Message, Slot.Data.Message, Slot.Data.Length + 1);
+	}
+
+	// Frees the slot for the producer that wraps around to it.
+	FPlatformAtomics::InterlockedExchange(&Slot.Sequence, static_cast<int32>(DequeuePosition + CAPACITY));
+	DequeuePosition++;
+	return true;
+}
+
+} // namespace SpatialGDK
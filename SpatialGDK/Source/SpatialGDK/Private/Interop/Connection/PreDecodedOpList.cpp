@@ -0,0 +1,64 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/PreDecodedOpList.h"
+
+#include "Interop/SpatialStaticComponentView.h"
+#include "Utils/SpatialTracer.h"
+
+namespace SpatialGDK
+{
+
+FPreDecodedOpList::FPreDecodedOpList(Worker_OpList* InOpList)
+	: OpList(InOpList)
+{
+}
+
+void FPreDecodedOpList::Decode()
+{
+	FSpatialTraceScope DecodeTrace(ESpatialTraceEvent::OpsThreadDecode);
+
+	DecodedComponents.SetNum(OpList->op_count);
+	DecodedUpdates.SetNum(OpList->op_count);
+	DecodedRPCs.SetNum(OpList->op_count);
+
+	for (size_t i = 0; i < OpList->op_count; ++i)
+	{
+		const Worker_Op& Op = OpList->ops[i];
+		if (Op.op_type == WORKER_OP_TYPE_ADD_COMPONENT)
+		{
+			DecodedComponents[i] = USpatialStaticComponentView::CreateComponentStorage(Op.add_component.data);
+		}
+		else if (Op.op_type == WORKER_OP_TYPE_COMPONENT_UPDATE)
+		{
+			const Worker_ComponentUpdate& Update = Op.component_update.update;
+			DecodedUpdates[i] = USpatialStaticComponentView::CreateComponentUpdateStorage(Update);
+
+			if (Update.component_id == SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID ||
+				Update.component_id == SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID ||
+				Update.component_id == SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID)
+			{
+				DecodedRPCs[i] = MakeUnique<RPCEndpointEvents>(Update);
+			}
+		}
+	}
+}
+
+TUniquePtr<ComponentStorageBase> FPreDecodedOpList::TakeDecodedComponent(size_t OpIndex)
+{
+	check(IsDecoded());
+	return MoveTemp(DecodedComponents[OpIndex]);
+}
+
+TUniquePtr<ComponentUpdateStorageBase> FPreDecodedOpList::TakeDecodedUpdate(size_t OpIndex)
+{
+	check(IsDecoded());
+	return MoveTemp(DecodedUpdates[OpIndex]);
+}
+
+TUniquePtr<RPCEndpointEvents> FPreDecodedOpList::TakeDecodedRPCs(size_t OpIndex)
+{
+	check(IsDecoded());
+	return MoveTemp(DecodedRPCs[OpIndex]);
+}
+
+} // namespace SpatialGDK
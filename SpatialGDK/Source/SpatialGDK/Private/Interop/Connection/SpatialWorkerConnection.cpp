@@ -17,6 +17,8 @@
 #include "EngineClasses/SpatialNetDriver.h"
 #include "SpatialGDKSettings.h"
 #include "Utils/ErrorCodeRemapping.h"
+#include "Utils/SpatialCounters.h"
+#include "Utils/SpatialTracer.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialWorkerConnection);
 
@@ -319,14 +321,13 @@ SpatialConnectionType USpatialWorkerConnection::GetConnectionType() const
 	}
 }
 
-TArray<Worker_OpList*> USpatialWorkerConnection::GetOpList()
+TArray<FPreDecodedOpList> USpatialWorkerConnection::GetOpList()
 {
-	TArray<Worker_OpList*> OpLists;
-	while (!OpListQueue.IsEmpty())
+	TArray<FPreDecodedOpList> OpLists;
+	FPreDecodedOpList OutOpList;
+	while (OpListQueue.Dequeue(OutOpList))
 	{
-		Worker_OpList* OutOpList;
-		OpListQueue.Dequeue(OutOpList);
-		OpLists.Add(OutOpList);
+		OpLists.Add(MoveTemp(OutOpList));
 	}
 
 	return OpLists;
@@ -362,6 +363,23 @@ void USpatialWorkerConnection::SendRemoveComponent(Worker_EntityId EntityId, Wor
 
 void USpatialWorkerConnection::SendComponentUpdate(Worker_EntityId EntityId, const Worker_ComponentUpdate* ComponentUpdate)
 {
+	if (Counters != nullptr)
+	{
+		const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+		if (SpatialGDKSettings->bEnableMetrics)
+		{
+			Counters->RecordComponentUpdateSent(ComponentUpdate->component_id);
+
+			// Measuring the size means walking the whole update, so it has its own opt-in.
+			if (SpatialGDKSettings->bEnableComponentUpdateSizeMetrics)
+			{
+				const uint32 Bytes = Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(ComponentUpdate->schema_type))
+					+ Schema_GetWriteBufferLength(Schema_GetComponentUpdateEvents(ComponentUpdate->schema_type));
+				Counters->RecordComponentUpdateBytesSent(ComponentUpdate->component_id, Bytes);
+			}
+		}
+	}
+
 	QueueOutgoingMessage<FComponentUpdate>(EntityId, *ComponentUpdate);
 }
 
@@ -383,7 +401,7 @@ void USpatialWorkerConnection::SendCommandFailure(Worker_RequestId RequestId, co
 
 void USpatialWorkerConnection::SendLogMessage(const uint8_t Level, const FName& LoggerName, const TCHAR* Message)
 {
-	QueueOutgoingMessage<FLogMessage>(Level, LoggerName, Message);
+	LogMessageBuffer.Push(Level, LoggerName, Message);
 }
 
 void USpatialWorkerConnection::SendComponentInterest(Worker_EntityId EntityId, TArray<Worker_InterestOverride>&& ComponentInterest)
@@ -479,7 +497,22 @@ void USpatialWorkerConnection::OnConnectionFailure()
 
 bool USpatialWorkerConnection::Init()
 {
-	OpsUpdateInterval = 1.0f / GetDefault<USpatialGDKSettings>()->OpsUpdateRate;
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	OpsUpdateInterval = 1.0f / SpatialGDKSettings->OpsUpdateRate;
+	LogForwardingInterval = SpatialGDKSettings->LogForwardingInterval;
+	MaxForwardedLogMessagesPerSecond = SpatialGDKSettings->MaxForwardedLogMessagesPerSecond;
+	LastLogFlushTime = FPlatformTime::Seconds();
+	LogSendAllowance = MaxForwardedLogMessagesPerSecond;
+
+	OutgoingLaneBudgets[static_cast<int32>(EOutgoingMessageLane::Control)] = MAX_int32;
+	OutgoingLaneBudgets[static_cast<int32>(EOutgoingMessageLane::Replication)] = MAX_int32;
+	OutgoingLaneBudgets[static_cast<int32>(EOutgoingMessageLane::Bulk)] = SpatialGDKSettings->OutgoingBulkMessagesPerOpsUpdate > 0 ? SpatialGDKSettings->OutgoingBulkMessagesPerOpsUpdate : MAX_int32;
+	OutgoingLaneBudgets[static_cast<int32>(EOutgoingMessageLane::Diagnostics)] = 1;
+
+	OutgoingLaneWeights[static_cast<int32>(EOutgoingMessageLane::Control)] = 8;
+	OutgoingLaneWeights[static_cast<int32>(EOutgoingMessageLane::Replication)] = 8;
+	OutgoingLaneWeights[static_cast<int32>(EOutgoingMessageLane::Bulk)] = 2;
+	OutgoingLaneWeights[static_cast<int32>(EOutgoingMessageLane::Diagnostics)] = 1;
 
 	return true;
 }
@@ -490,14 +523,28 @@ uint32 USpatialWorkerConnection::Run()
 	{
 		FPlatformProcess::Sleep(OpsUpdateInterval);
 
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
 		QueueLatestOpList();
 
 		ProcessOutgoingMessages();
+
+		FlushLogMessages(false);
+
+		OpsThreadBusyCycles.Add(FPlatformTime::Cycles64() - StartCycles);
 	}
 
+	// Don't lose the last messages logged before the connection is destroyed.
+	FlushLogMessages(true);
+
 	return 0;
 }
 
+double USpatialWorkerConnection::ConsumeOpsThreadBusySeconds()
+{
+	return FPlatformTime::ToSeconds64(OpsThreadBusyCycles.Set(0));
+}
+
 void USpatialWorkerConnection::Stop()
 {
 	KeepRunning.AtomicSet(false);
@@ -513,10 +560,15 @@ void USpatialWorkerConnection::InitializeOpsProcessingThread()
 
 void USpatialWorkerConnection::QueueLatestOpList()
 {
+	FSpatialTraceScope ReceiveTrace(ESpatialTraceEvent::OpsThreadReceive);
+
 	Worker_OpList* OpList = Worker_Connection_GetOpList(WorkerConnection, 0);
 	if (OpList->op_count > 0)
 	{
-		OpListQueue.Enqueue(OpList);
+		// Decoding here rather than on the game thread leaves it less to do in TickDispatch.
+		FPreDecodedOpList PreDecodedOpList(OpList);
+		PreDecodedOpList.Decode();
+		OpListQueue.Enqueue(MoveTemp(PreDecodedOpList));
 	}
 	else
 	{
@@ -526,11 +578,16 @@ void USpatialWorkerConnection::QueueLatestOpList()
 
 void USpatialWorkerConnection::ProcessOutgoingMessages()
 {
-	while (!OutgoingMessagesQueue.IsEmpty())
-	{
-		TUniquePtr<FOutgoingMessage> OutgoingMessage;
-		OutgoingMessagesQueue.Dequeue(OutgoingMessage);
+	FSpatialTraceScope SendTrace(ESpatialTraceEvent::OpsThreadSend);
+
+	FOutgoingDrainState DrainState;
+	FMemory::Memcpy(DrainState.RemainingLaneBudgets, OutgoingLaneBudgets);
+	DrainState.Lane = 0;
+	DrainState.RemainingLaneWeight = OutgoingLaneWeights[0];
 
+	TUniquePtr<FOutgoingMessage> OutgoingMessage;
+	while (DequeueOutgoingMessage(OutgoingMessage, DrainState))
+	{
 		switch (OutgoingMessage->Type)
 		{
 		case EOutgoingMessageType::ReserveEntityIdsRequest:
@@ -626,20 +683,6 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 				TCHAR_TO_UTF8(*Message->Message));
 			break;
 		}
-		case EOutgoingMessageType::LogMessage:
-		{
-			FLogMessage* Message = static_cast<FLogMessage*>(OutgoingMessage.Get());
-
-			FTCHARToUTF8 LoggerName(*Message->LoggerName.ToString());
-			FTCHARToUTF8 LogString(*Message->Message);
-
-			Worker_LogMessage LogMessage{};
-			LogMessage.level = Message->Level;
-			LogMessage.logger_name = LoggerName.Get();
-			LogMessage.message = LogString.Get();
-			Worker_Connection_SendLogMessage(WorkerConnection, &LogMessage);
-			break;
-		}
 		case EOutgoingMessageType::ComponentInterest:
 		{
 			FComponentInterest* Message = static_cast<FComponentInterest*>(OutgoingMessage.Get());
@@ -682,6 +725,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 			TArray<Worker_HistogramMetric> WorkerHistogramMetrics;
 			TArray<TArray<Worker_HistogramMetricBucket>> WorkerHistogramMetricBuckets;
 			WorkerHistogramMetrics.SetNum(Message->Metrics.HistogramMetrics.Num());
+			WorkerHistogramMetricBuckets.SetNum(Message->Metrics.HistogramMetrics.Num());
 			for (int i = 0; i < Message->Metrics.HistogramMetrics.Num(); i++)
 			{
 				WorkerHistogramMetrics[i].key = Message->Metrics.HistogramMetrics[i].Key.c_str();
@@ -713,10 +757,154 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 	}
 }
 
+bool USpatialWorkerConnection::DequeueOutgoingMessage(TUniquePtr<FOutgoingMessage>& OutMessage, FOutgoingDrainState& DrainState)
+{
+	// Stay on the current lane until it has sent its weight's worth of messages, runs out of budget or empties. Visiting
+	// every lane once more before giving up means a lane that ran out of weight gets a fresh turn if it's the only one left.
+	for (int32 LanesVisited = 0; LanesVisited <= NUM_OUTGOING_LANES; LanesVisited++)
+	{
+		const int32 Lane = DrainState.Lane;
+		if (DrainState.RemainingLaneWeight <= 0 || DrainState.RemainingLaneBudgets[Lane] <= 0 || !OutgoingMessagesQueues[Lane].Dequeue(OutMessage))
+		{
+			DrainState.Lane = (Lane + 1) % NUM_OUTGOING_LANES;
+			DrainState.RemainingLaneWeight = OutgoingLaneWeights[DrainState.Lane];
+			continue;
+		}
+
+		DrainState.RemainingLaneWeight--;
+		DrainState.RemainingLaneBudgets[Lane]--;
+
+		FOutgoingLaneStats& Stats = OutgoingLaneStats[Lane];
+		Stats.Depth.Decrement();
+
+		// The game thread resets the maximum when it reports it, so only replace the value we compared against.
+		const int32 LatencyMicroseconds = static_cast<int32>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles() - OutMessage->QueuedCycles) * 1000.0f);
+		int32 MaxLatencyMicroseconds = FPlatformAtomics::AtomicRead(&Stats.MaxLatencyMicroseconds);
+		while (LatencyMicroseconds > MaxLatencyMicroseconds)
+		{
+			const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(&Stats.MaxLatencyMicroseconds, LatencyMicroseconds, MaxLatencyMicroseconds);
+			if (Previous == MaxLatencyMicroseconds)
+			{
+				break;
+			}
+			MaxLatencyMicroseconds = Previous;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+void USpatialWorkerConnection::FlushLogMessages(bool bForce)
+{
+	const double Now = FPlatformTime::Seconds();
+	const double SecondsSinceLastFlush = Now - LastLogFlushTime;
+	if (!bForce && SecondsSinceLastFlush < LogForwardingInterval)
+	{
+		return;
+	}
+	LastLogFlushTime = Now;
+
+	// Allows bursts of up to a second's worth of messages.
+	const bool bRateLimited = MaxForwardedLogMessagesPerSecond > 0.0f;
+	if (bRateLimited)
+	{
+		LogSendAllowance = FMath::Min(LogSendAllowance + SecondsSinceLastFlush * MaxForwardedLogMessagesPerSecond, static_cast<double>(MaxForwardedLogMessagesPerSecond));
+	}
+
+	// Drain the whole buffer even when over the send allowance, so loggers have room again and repeats of a message
+	// logged since the last flush collapse into a single message with a count.
+	PendingLogMessages.Reset();
+	PendingLogMessageIndices.Reset();
+	for (;;)
+	{
+		const int32 Index = PendingLogMessages.AddDefaulted();
+		FPendingLogMessage& Pending = PendingLogMessages[Index];
+		if (!LogMessageBuffer.Pop(Pending.Message))
+		{
+			PendingLogMessages.RemoveAt(Index, 1, false);
+			break;
+		}
+
+		const FBufferedLogMessage& Message = Pending.Message;
+		const uint32 Hash = HashCombine(FCrc::MemCrc32(Message.GetMessage(), Message.Length), HashCombine(GetTypeHash(Message.LoggerName), Message.Level));
+
+		if (int32* ExistingIndex = PendingLogMessageIndices.Find(Hash))
+		{
+			FPendingLogMessage& Existing = PendingLogMessages[*ExistingIndex];
+			if (Existing.Message.Level == Message.Level && Existing.Message.LoggerName == Message.LoggerName &&
+				Existing.Message.Length == Message.Length && FMemory::Memcmp(Existing.Message.GetMessage(), Message.GetMessage(), Message.Length) == 0)
+			{
+				Existing.Count++;
+				PendingLogMessages.RemoveAt(Index, 1, false);
+				continue;
+			}
+		}
+		else
+		{
+			PendingLogMessageIndices.Add(Hash, Index);
+		}
+
+		Pending.Count = 1;
+	}
+
+	int32 NumDropped = LogMessageBuffer.ConsumeNumDropped();
+
+	for (const FPendingLogMessage& Pending : PendingLogMessages)
+	{
+		// Errors are always forwarded, and don't use up the allowance of less severe messages.
+		if (bRateLimited && Pending.Message.Level < WORKER_LOG_LEVEL_ERROR)
+		{
+			if (LogSendAllowance < 1.0)
+			{
+				NumDropped += Pending.Count;
+				continue;
+			}
+			LogSendAllowance -= 1.0;
+		}
+
+		if (Pending.Count > 1)
+		{
+			TArray<ANSICHAR, TInlineAllocator<FBufferedLogMessage::MAX_MESSAGE_BYTES + 32>> RepeatedMessage;
+			RepeatedMessage.SetNumUninitialized(Pending.Message.Length + 32);
+			FCStringAnsi::Snprintf(RepeatedMessage.GetData(), RepeatedMessage.Num(), "%s (repeated %u times)", Pending.Message.GetMessage(), Pending.Count);
+			SendLogMessageToWorker(Pending.Message.Level, Pending.Message.LoggerName, RepeatedMessage.GetData());
+		}
+		else
+		{
+			SendLogMessageToWorker(Pending.Message.Level, Pending.Message.LoggerName, Pending.Message.GetMessage());
+		}
+	}
+
+	if (NumDropped > 0)
+	{
+		ANSICHAR DroppedMessage[128];
+		FCStringAnsi::Snprintf(DroppedMessage, ARRAY_COUNT(DroppedMessage), "%d log messages were dropped because too many were logged at once.", NumDropped);
+		SendLogMessageToWorker(WORKER_LOG_LEVEL_WARN, TEXT("Unreal"), DroppedMessage);
+	}
+}
+
+void USpatialWorkerConnection::SendLogMessageToWorker(uint8_t Level, const FName& LoggerName, const char* Message)
+{
+	FTCHARToUTF8 LoggerNameString(*LoggerName.ToString());
+
+	Worker_LogMessage LogMessage{};
+	LogMessage.level = Level;
+	LogMessage.logger_name = LoggerNameString.Get();
+	LogMessage.message = Message;
+	Worker_Connection_SendLogMessage(WorkerConnection, &LogMessage);
+}
+
 template <typename T, typename... ArgsType>
 void USpatialWorkerConnection::QueueOutgoingMessage(ArgsType&&... Args)
 {
 	// TODO UNR-1271: As later optimization, we can change the queue to hold a union
 	// of all outgoing message types, rather than having a pointer.
-	OutgoingMessagesQueue.Enqueue(MakeUnique<T>(Forward<ArgsType>(Args)...));
+	TUniquePtr<FOutgoingMessage> Message = MakeUnique<T>(Forward<ArgsType>(Args)...);
+	Message->QueuedCycles = FPlatformTime::Cycles();
+
+	const int32 Lane = static_cast<int32>(GetOutgoingMessageLane(*Message));
+	OutgoingMessagesQueues[Lane].Enqueue(MoveTemp(Message));
+	OutgoingLaneStats[Lane].Depth.Increment();
 }
@@ -16,6 +16,7 @@
 #include "EngineUtils.h"
 #include "GameFramework/GameModeBase.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/SpatialClassInfoManager.h"
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialSender.h"
 #include "Kismet/GameplayStatics.h"
@@ -61,7 +62,7 @@ void UGlobalStateManager::Init(USpatialNetDriver* InNetDriver, FTimerManager* In
 void UGlobalStateManager::ApplySingletonManagerData(const Worker_ComponentData& Data)
 {
 	Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
-	SingletonNameToEntityId = GetStringToEntityMapFromSchema(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_NAME_TO_ENTITY_ID);
+	SetSingletonClassIdToEntityId(GetComponentIdToEntityMapFromSchema(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_CLASS_ID_TO_ENTITY_ID));
 }
 
 void UGlobalStateManager::ApplyDeploymentMapData(const Worker_ComponentData& Data)
@@ -86,14 +87,55 @@ void UGlobalStateManager::ApplyStartupActorManagerData(const Worker_ComponentDat
 
 void UGlobalStateManager::ApplySingletonManagerUpdate(const Worker_ComponentUpdate& Update)
 {
+	// Updates carry the full map for the component data, and an event for each entry that changed. Only the events need to be applied.
+	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Update.schema_type);
+	const uint32 EventCount = Schema_GetObjectCount(EventsObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_ENTITY_CREATED_EVENT_ID);
+	if (EventCount > 0)
+	{
+		for (uint32 i = 0; i < EventCount; i++)
+		{
+			Schema_Object* EventObject = Schema_IndexObject(EventsObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_ENTITY_CREATED_EVENT_ID, i);
+			AddSingletonEntityId(Schema_GetUint32(EventObject, SpatialConstants::SINGLETON_ENTITY_CREATED_CLASS_ID), Schema_GetEntityId(EventObject, SpatialConstants::SINGLETON_ENTITY_CREATED_ENTITY_ID));
+		}
+		return;
+	}
+
 	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
 
-	if (Schema_GetObjectCount(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_NAME_TO_ENTITY_ID) > 0)
+	if (Schema_GetObjectCount(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_CLASS_ID_TO_ENTITY_ID) > 0)
+	{
+		SetSingletonClassIdToEntityId(GetComponentIdToEntityMapFromSchema(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_CLASS_ID_TO_ENTITY_ID));
+	}
+}
+
+void UGlobalStateManager::SetSingletonClassIdToEntityId(ComponentIdToEntityMap&& InSingletonClassIdToEntityId)
+{
+	SingletonClassIdToEntityId = MoveTemp(InSingletonClassIdToEntityId);
+
+	SingletonEntityIds.Reset();
+	for (const auto& Pair : SingletonClassIdToEntityId)
 	{
-		SingletonNameToEntityId = GetStringToEntityMapFromSchema(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_NAME_TO_ENTITY_ID);
+		SingletonEntityIds.Add(Pair.Value);
 	}
 }
 
+void UGlobalStateManager::AddSingletonEntityId(Worker_ComponentId SingletonClassId, Worker_EntityId SingletonEntityId)
+{
+	Worker_EntityId& EntityId = SingletonClassIdToEntityId.FindOrAdd(SingletonClassId);
+	if (EntityId != SpatialConstants::INVALID_ENTITY_ID && EntityId != SingletonEntityId)
+	{
+		SingletonEntityIds.Remove(EntityId);
+	}
+
+	EntityId = SingletonEntityId;
+	SingletonEntityIds.Add(SingletonEntityId);
+}
+
+Worker_ComponentId UGlobalStateManager::GetSingletonClassId(UClass* SingletonClass) const
+{
+	return NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(SingletonClass).SchemaComponents[SCHEMA_Data];
+}
+
 void UGlobalStateManager::ApplyDeploymentMapUpdate(const Worker_ComponentUpdate& Update)
 {
 	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
@@ -214,12 +256,12 @@ void UGlobalStateManager::ApplyCanBeginPlayUpdate(const bool bCanBeginPlayUpdate
 	bCanBeginPlay = bCanBeginPlayUpdate;
 }
 
-void UGlobalStateManager::LinkExistingSingletonActor(const UClass* SingletonActorClass)
+void UGlobalStateManager::LinkExistingSingletonActor(UClass* SingletonActorClass)
 {
-	const Worker_EntityId* SingletonEntityIdPtr = SingletonNameToEntityId.Find(SingletonActorClass->GetPathName());
+	const Worker_EntityId* SingletonEntityIdPtr = SingletonClassIdToEntityId.Find(GetSingletonClassId(SingletonActorClass));
 	if (SingletonEntityIdPtr == nullptr)
 	{
-		// No entry in SingletonNameToEntityId for this singleton class type
+		// No entry in SingletonClassIdToEntityId for this singleton class type
 		UE_LOG(LogGlobalStateManager, Verbose, TEXT("LinkExistingSingletonActor %s failed to find entry"), *SingletonActorClass->GetName());
 		return;
 	}
@@ -290,15 +332,12 @@ void UGlobalStateManager::LinkAllExistingSingletonActors()
 		return;
 	}
 
-	for (const auto& Pair : SingletonNameToEntityId)
-	{
-		UClass* SingletonActorClass = LoadObject<UClass>(nullptr, *Pair.Key);
-		if (SingletonActorClass == nullptr)
-		{
-			UE_LOG(LogGlobalStateManager, Error, TEXT("Failed to find Singleton Actor Class: %s"), *Pair.Key);
-			continue;
-		}
+	// Only singletons registered on this worker can be linked, so there's no need to load the classes of the others.
+	TArray<UClass*> SingletonActorClasses;
+	NetDriver->SingletonActorChannels.GetKeys(SingletonActorClasses);
 
+	for (UClass* SingletonActorClass : SingletonActorClasses)
+	{
 		LinkExistingSingletonActor(SingletonActorClass);
 	}
 }
@@ -334,7 +373,7 @@ USpatialActorChannel* UGlobalStateManager::AddSingleton(AActor* SingletonActor)
 
 		// If entity id already exists for this singleton, set the actor to it
 		// Otherwise SetChannelActor will issue a new entity id request
-		if (const Worker_EntityId* SingletonEntityId = SingletonNameToEntityId.Find(SingletonActorClass->GetPathName()))
+		if (const Worker_EntityId* SingletonEntityId = SingletonClassIdToEntityId.Find(GetSingletonClassId(SingletonActorClass)))
 		{
 			check(NetDriver->PackageMap->GetObjectFromEntityId(*SingletonEntityId) == nullptr);
 			NetDriver->PackageMap->ResolveEntityActor(SingletonActor, *SingletonEntityId);
@@ -377,14 +416,32 @@ void UGlobalStateManager::ExecuteInitialSingletonActorReplication()
 	}
 }
 
-void UGlobalStateManager::UpdateSingletonEntityId(const FString& ClassName, const Worker_EntityId SingletonEntityId)
+void UGlobalStateManager::UpdateSingletonEntityId(UClass* SingletonClass, const Worker_EntityId SingletonEntityId)
 {
-	Worker_EntityId& EntityId = SingletonNameToEntityId.FindOrAdd(ClassName);
-	EntityId = SingletonEntityId;
+	const Worker_ComponentId SingletonClassId = GetSingletonClassId(SingletonClass);
+	AddSingletonEntityId(SingletonClassId, SingletonEntityId);
 
 	if (!NetDriver->StaticComponentView->HasAuthority(GlobalStateManagerEntityId, SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID))
 	{
-		UE_LOG(LogGlobalStateManager, Warning, TEXT("UpdateSingletonEntityId: no authority over the GSM! Update will not be sent. Singleton class: %s, entity: %lld"), *ClassName, SingletonEntityId);
+		UE_LOG(LogGlobalStateManager, Warning, TEXT("UpdateSingletonEntityId: no authority over the GSM! Update will not be sent. Singleton class: %s, entity: %lld"), *SingletonClass->GetPathName(), SingletonEntityId);
+		return;
+	}
+
+	// Singletons are usually created in bursts during startup, so they're sent together in FlushSingletonManagerUpdates.
+	PendingSingletonEntityIds.Add(SingletonClassId, SingletonEntityId);
+}
+
+void UGlobalStateManager::FlushSingletonManagerUpdates()
+{
+	if (PendingSingletonEntityIds.Num() == 0)
+	{
+		return;
+	}
+
+	if (!NetDriver->StaticComponentView->HasAuthority(GlobalStateManagerEntityId, SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID))
+	{
+		UE_LOG(LogGlobalStateManager, Warning, TEXT("FlushSingletonManagerUpdates: lost authority over the GSM! %d singleton entity ids will not be sent."), PendingSingletonEntityIds.Num());
+		PendingSingletonEntityIds.Reset();
 		return;
 	}
 
@@ -392,22 +449,27 @@ void UGlobalStateManager::UpdateSingletonEntityId(const FString& ClassName, cons
 	Update.component_id = SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID;
 	Update.schema_type = Schema_CreateComponentUpdate(SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID);
 	Schema_Object* UpdateObject = Schema_GetComponentUpdateFields(Update.schema_type);
+	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Update.schema_type);
+
+	// Map fields can't be updated partially, so the persisted map is written whole. Only the events are incremental, and they
+	// only save receivers from parsing the map.
+	AddComponentIdToEntityMapToSchema(UpdateObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_CLASS_ID_TO_ENTITY_ID, SingletonClassIdToEntityId);
+
+	for (const auto& Pair : PendingSingletonEntityIds)
+	{
+		Schema_Object* EventObject = Schema_AddObject(EventsObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_ENTITY_CREATED_EVENT_ID);
+		Schema_AddUint32(EventObject, SpatialConstants::SINGLETON_ENTITY_CREATED_CLASS_ID, Pair.Key);
+		Schema_AddEntityId(EventObject, SpatialConstants::SINGLETON_ENTITY_CREATED_ENTITY_ID, Pair.Value);
+	}
 
-	AddStringToEntityMapToSchema(UpdateObject, 1, SingletonNameToEntityId);
+	PendingSingletonEntityIds.Reset();
 
 	NetDriver->Connection->SendComponentUpdate(GlobalStateManagerEntityId, &Update);
 }
 
 bool UGlobalStateManager::IsSingletonEntity(Worker_EntityId EntityId) const
 {
-	for (const auto& Pair : SingletonNameToEntityId)
-	{
-		if (Pair.Value == EntityId)
-		{
-			return true;
-		}
-	}
-	return false;
+	return SingletonEntityIds.Contains(EntityId);
 }
 
 void UGlobalStateManager::SetAcceptingPlayers(bool bInAcceptingPlayers)
@@ -520,7 +582,7 @@ void UGlobalStateManager::BeginDestroy()
 			Worker_ComponentUpdate Update = {};
 			Update.component_id = SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID;
 			Update.schema_type = Schema_CreateComponentUpdate(SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID);
-			Schema_AddComponentUpdateClearedField(Update.schema_type, SpatialConstants::SINGLETON_MANAGER_SINGLETON_NAME_TO_ENTITY_ID);
+			Schema_AddComponentUpdateClearedField(Update.schema_type, SpatialConstants::SINGLETON_MANAGER_SINGLETON_CLASS_ID_TO_ENTITY_ID);
 
 			NetDriver->Connection->SendComponentUpdate(GlobalStateManagerEntityId, &Update);
 		}
@@ -3,6 +3,7 @@
 #include "Interop/SpatialClassInfoManager.h"
 
 #include "AssetRegistryModule.h"
+#include "Engine/BlueprintCore.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/Engine.h"
 #include "GameFramework/Actor.h"
@@ -37,9 +38,26 @@ bool USpatialClassInfoManager::TryInit(USpatialNetDriver* InNetDriver, UActorGro
 		return false;
 	}
 
+	FCoreUObjectDelegates::OnAssetLoaded.AddUObject(this, &USpatialClassInfoManager::OnAssetLoaded);
+	FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &USpatialClassInfoManager::InvalidateClassCaches);
+#if WITH_HOT_RELOAD
+	FCoreUObjectDelegates::RegisterHotReloadAddedClassesDelegate.AddUObject(this, &USpatialClassInfoManager::OnHotReloadAddedClasses);
+#endif
+
 	return true;
 }
 
+void USpatialClassInfoManager::BeginDestroy()
+{
+	FCoreUObjectDelegates::OnAssetLoaded.RemoveAll(this);
+	FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+#if WITH_HOT_RELOAD
+	FCoreUObjectDelegates::RegisterHotReloadAddedClassesDelegate.RemoveAll(this);
+#endif
+
+	Super::BeginDestroy();
+}
+
 FORCEINLINE UClass* ResolveClass(FString& ClassPath)
 {
 	FSoftClassPath SoftClassPath(ClassPath);
@@ -138,6 +156,7 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 				HandoverInfo.Offset = Property->GetOffset_ForGC() + Property->ElementSize * ArrayIdx;
 				HandoverInfo.ArrayIdx = ArrayIdx;
 				HandoverInfo.Property = Property;
+				HandoverInfo.Handler = SpatialGDK::MakeFieldApplyHandler(Property);
 
 				Info->HandoverProperties.Add(HandoverInfo);
 			}
@@ -159,6 +178,9 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 	if (Class->IsChildOf<AActor>())
 	{
 		FinishConstructingActorClassInfo(ClassPath, Info);
+
+		// OnAssetLoaded only fires in editor builds, so this is where a cooked build first sees a class loaded after the index was built.
+		AddClassToHierarchyIndex(Class, Info->SchemaComponents[SCHEMA_Data]);
 	}
 	else
 	{
@@ -228,8 +250,10 @@ void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& C
 	{
 		if (ActorClass->IsChildOf<AActor>())
 		{
-			Info->ActorGroup = ActorGroupManager->GetActorGroupForClass(TSubclassOf<AActor>(ActorClass));
-			Info->WorkerType = ActorGroupManager->GetWorkerTypeForClass(TSubclassOf<AActor>(ActorClass));
+			// Also resolves the class's Actor ancestors, so looking up a parent class later doesn't walk the hierarchy.
+			const FClassActorGroup& ClassActorGroup = ActorGroupManager->GetOrResolveClassActorGroup(ActorClass);
+			Info->ActorGroup = ClassActorGroup.ActorGroup;
+			Info->WorkerType = ClassActorGroup.WorkerType;
 
 			UE_LOG(LogSpatialClassInfoManager, VeryVerbose, TEXT("[%s] is in ActorGroup [%s], on WorkerType [%s]"),
 				*ActorClass->GetPathName(), *Info->ActorGroup.ToString(), *Info->WorkerType.ToString())
@@ -290,6 +314,16 @@ const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByClass(UClass*
 	return ClassInfoMap[Class].Get();
 }
 
+TSharedRef<const SpatialGDK::FRepApplyPlan> USpatialClassInfoManager::GetOrCreateRepApplyPlan(UClass* Class, const FRepLayout& RepLayout)
+{
+	if (const TSharedRef<const SpatialGDK::FRepApplyPlan>* Plan = RepApplyPlanMap.Find(Class))
+	{
+		return *Plan;
+	}
+
+	return RepApplyPlanMap.Add(Class, SpatialGDK::BuildRepApplyPlan(RepLayout));
+}
+
 const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByObject(UObject* Object)
 {
 	if (AActor* Actor = Cast<AActor>(Object))
@@ -356,18 +390,14 @@ TArray<Worker_ComponentId> USpatialClassInfoManager::GetComponentIdsForClassHier
 	check(SchemaDatabase);
 	if (bIncludeDerivedTypes)
 	{
-		for (TObjectIterator<UClass> It; It; ++It)
+		if (bClassHierarchyIndexDirty)
 		{
-			const UClass* Class = *It;
-			check(Class);
-			if (Class->IsChildOf(&BaseClass))
-			{
-				const Worker_ComponentId ComponentId = GetComponentIdForClass(*Class);
-				if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
-				{
-					OutComponentIds.Add(ComponentId);
-				}
-			}
+			BuildClassHierarchyIndex();
+		}
+
+		if (const TArray<Worker_ComponentId>* ComponentIds = ClassHierarchyComponentIds.Find(&BaseClass))
+		{
+			OutComponentIds = *ComponentIds;
 		}
 	}
 	else
@@ -383,6 +413,96 @@ TArray<Worker_ComponentId> USpatialClassInfoManager::GetComponentIdsForClassHier
 	return OutComponentIds;
 }
 
+void USpatialClassInfoManager::BuildClassHierarchyIndex() const
+{
+	ClassHierarchyComponentIds.Reset();
+
+	for (const auto& ClassPathToSchema : SchemaDatabase->ActorClassPathToSchema)
+	{
+		const Worker_ComponentId ComponentId = ClassPathToSchema.Value.SchemaComponents[SCHEMA_Data];
+		if (ComponentId == SpatialConstants::INVALID_COMPONENT_ID)
+		{
+			continue;
+		}
+
+		// Only consider classes that are already loaded, the index is rebuilt when more are.
+		FSoftClassPath SoftClassPath(ClassPathToSchema.Key);
+		for (const UClass* Class = SoftClassPath.ResolveClass(); Class != nullptr; Class = Class->GetSuperClass())
+		{
+			ClassHierarchyComponentIds.FindOrAdd(Class).Add(ComponentId);
+		}
+	}
+
+	for (auto& ClassToComponentIds : ClassHierarchyComponentIds)
+	{
+		ClassToComponentIds.Value.Sort();
+	}
+
+	bClassHierarchyIndexDirty = false;
+	ClassHierarchyIndexVersion++;
+}
+
+void USpatialClassInfoManager::AddClassToHierarchyIndex(const UClass* Class, Worker_ComponentId ComponentId)
+{
+	// A dirty index is rebuilt from every loaded class before it's next read, which includes this one.
+	if (bClassHierarchyIndexDirty || ComponentId == SpatialConstants::INVALID_COMPONENT_ID)
+	{
+		return;
+	}
+
+	const TArray<Worker_ComponentId>* IndexedComponentIds = ClassHierarchyComponentIds.Find(Class);
+	if (IndexedComponentIds != nullptr && IndexedComponentIds->Contains(ComponentId))
+	{
+		return;
+	}
+
+	for (const UClass* HierarchyClass = Class; HierarchyClass != nullptr; HierarchyClass = HierarchyClass->GetSuperClass())
+	{
+		TArray<Worker_ComponentId>& ComponentIds = ClassHierarchyComponentIds.FindOrAdd(HierarchyClass);
+
+		int32 InsertIndex = 0;
+		while (InsertIndex < ComponentIds.Num() && ComponentIds[InsertIndex] < ComponentId)
+		{
+			InsertIndex++;
+		}
+		ComponentIds.Insert(ComponentId, InsertIndex);
+	}
+
+	ClassHierarchyIndexVersion++;
+}
+
+uint32 USpatialClassInfoManager::GetClassHierarchyIndexVersion() const
+{
+	if (bClassHierarchyIndexDirty)
+	{
+		BuildClassHierarchyIndex();
+	}
+
+	return ClassHierarchyIndexVersion;
+}
+
+void USpatialClassInfoManager::InvalidateClassCaches()
+{
+	bClassHierarchyIndexDirty = true;
+
+	// Plans hold raw property pointers, which a reloaded or collected class leaves dangling.
+	RepApplyPlanMap.Reset();
+}
+
+void USpatialClassInfoManager::OnAssetLoaded(UObject* Asset)
+{
+	if (Asset != nullptr && (Asset->IsA<UClass>() || Asset->IsA<UBlueprintCore>()))
+	{
+		InvalidateClassCaches();
+	}
+}
+
+#if WITH_HOT_RELOAD
+void USpatialClassInfoManager::OnHotReloadAddedClasses(const TArray<UClass*>& AddedClasses)
+{
+	InvalidateClassCaches();
+}
+#endif
 
 bool USpatialClassInfoManager::GetOffsetByComponentId(Worker_ComponentId ComponentId, uint32& OutOffset)
 {
@@ -4,15 +4,83 @@
 
 #include "EngineClasses/SpatialNetConnection.h"
 #include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/Connection/PreDecodedOpList.h"
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialStaticComponentView.h"
 #include "Interop/SpatialWorkerFlags.h"
 #include "UObject/UObjectIterator.h"
 #include "Utils/OpUtils.h"
-
+#include "Utils/SpatialTracer.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialView);
 
+namespace
+{
+// The component op types user callbacks can be registered for, each given a column in the callback table.
+const int32 NUM_CALLBACK_OP_TYPES = 6;
+
+int32 GetCallbackOpTypeIndex(Worker_OpType OpType)
+{
+	switch (OpType)
+	{
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		return 0;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		return 1;
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		return 2;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+		return 3;
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+		return 4;
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+		return 5;
+	default:
+		checkNoEntry();
+		return INDEX_NONE;
+	}
+}
+
+void GetOpTraceIds(const Worker_Op* Op, Worker_EntityId& OutEntityId, Worker_ComponentId& OutComponentId)
+{
+	switch (Op->op_type)
+	{
+	case WORKER_OP_TYPE_ADD_ENTITY:
+		OutEntityId = Op->add_entity.entity_id;
+		break;
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+		OutEntityId = Op->remove_entity.entity_id;
+		break;
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		OutEntityId = Op->add_component.entity_id;
+		OutComponentId = Op->add_component.data.component_id;
+		break;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		OutEntityId = Op->remove_component.entity_id;
+		OutComponentId = Op->remove_component.component_id;
+		break;
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		OutEntityId = Op->authority_change.entity_id;
+		OutComponentId = Op->authority_change.component_id;
+		break;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+		OutEntityId = Op->component_update.entity_id;
+		OutComponentId = Op->component_update.update.component_id;
+		break;
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+		OutEntityId = Op->command_request.entity_id;
+		OutComponentId = Op->command_request.request.component_id;
+		break;
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+		OutEntityId = Op->command_response.entity_id;
+		OutComponentId = Op->command_response.response.component_id;
+		break;
+	default:
+		break;
+	}
+}
+}
+
 void USpatialDispatcher::Init(USpatialNetDriver* InNetDriver)
 {
 	NetDriver = InNetDriver;
@@ -22,17 +90,41 @@ void USpatialDispatcher::Init(USpatialNetDriver* InNetDriver)
 
 void USpatialDispatcher::ProcessOps(Worker_OpList* OpList)
 {
+	ProcessOps(OpList, nullptr);
+}
+
+void USpatialDispatcher::ProcessOps(SpatialGDK::FPreDecodedOpList& OpList)
+{
+	ProcessOps(OpList.OpList, OpList.IsDecoded() ? &OpList : nullptr);
+}
+
+void USpatialDispatcher::ProcessOps(Worker_OpList* OpList, SpatialGDK::FPreDecodedOpList* PreDecodedOpList)
+{
+	FSpatialTraceScope ProcessOpsTrace(ESpatialTraceEvent::ProcessOps);
+
+	FSpatialCounters& Counters = NetDriver->GetCounters();
+
 	for (size_t i = 0; i < OpList->op_count; ++i)
 	{
 		Worker_Op* Op = &OpList->ops[i];
 
+		// Skipped ops were already processed, and counted, when the startup flow picked them out.
 		if (OpsToSkip.Num() != 0 &&
-			OpsToSkip.Contains(Op))
+			OpsToSkip.Remove(Op) > 0)
 		{
-			OpsToSkip.Remove(Op);
 			continue;
 		}
 
+		Counters.Increment(FSpatialCounters::GetOpCounter(static_cast<Worker_OpType>(Op->op_type)));
+
+		Worker_EntityId TraceEntityId = SpatialConstants::INVALID_ENTITY_ID;
+		Worker_ComponentId TraceComponentId = SpatialConstants::INVALID_COMPONENT_ID;
+		if (FSpatialTracer::IsEnabled())
+		{
+			GetOpTraceIds(Op, TraceEntityId, TraceComponentId);
+		}
+		FSpatialTraceScope OpTrace(FSpatialTracer::GetOpEvent(static_cast<Worker_OpType>(Op->op_type)), TraceEntityId, TraceComponentId);
+
 		if (IsExternalSchemaOp(Op))
 		{
 			ProcessExternalSchemaOp(Op);
@@ -58,15 +150,30 @@ void USpatialDispatcher::ProcessOps(Worker_OpList* OpList)
 
 		// Components
 		case WORKER_OP_TYPE_ADD_COMPONENT:
-			StaticComponentView->OnAddComponent(Op->add_component);
+			if (PreDecodedOpList != nullptr)
+			{
+				StaticComponentView->OnAddComponent(Op->add_component, PreDecodedOpList->TakeDecodedComponent(i));
+			}
+			else
+			{
+				StaticComponentView->OnAddComponent(Op->add_component);
+			}
 			Receiver->OnAddComponent(Op->add_component);
 			break;
 		case WORKER_OP_TYPE_REMOVE_COMPONENT:
 			Receiver->OnRemoveComponent(Op->remove_component);
 			break;
 		case WORKER_OP_TYPE_COMPONENT_UPDATE:
-			StaticComponentView->OnComponentUpdate(Op->component_update);
-			Receiver->OnComponentUpdate(Op->component_update);
+			if (PreDecodedOpList != nullptr)
+			{
+				StaticComponentView->OnComponentUpdate(Op->component_update, PreDecodedOpList->TakeDecodedUpdate(i));
+				Receiver->OnComponentUpdate(Op->component_update, PreDecodedOpList->TakeDecodedRPCs(i));
+			}
+			else
+			{
+				StaticComponentView->OnComponentUpdate(Op->component_update);
+				Receiver->OnComponentUpdate(Op->component_update);
+			}
 			break;
 
 		// Commands
@@ -198,77 +305,62 @@ USpatialDispatcher::FCallbackId USpatialDispatcher::OnCommandResponse(Worker_Com
 USpatialDispatcher::FCallbackId USpatialDispatcher::AddGenericOpCallback(Worker_ComponentId ComponentId, Worker_OpType OpType, const TFunction<void(const Worker_Op*)>& Callback)
 {
 	check(SpatialConstants::MIN_EXTERNAL_SCHEMA_ID <= ComponentId && ComponentId <= SpatialConstants::MAX_EXTERNAL_SCHEMA_ID);
+
+	if (CallbackTable.Num() == 0)
+	{
+		CallbackTable.SetNum((SpatialConstants::MAX_EXTERNAL_SCHEMA_ID - SpatialConstants::MIN_EXTERNAL_SCHEMA_ID + 1) * NUM_CALLBACK_OP_TYPES);
+	}
+
 	const FCallbackId NewCallbackId = NextCallbackId++;
-	ComponentOpTypeToCallbacksMap.FindOrAdd(ComponentId).FindOrAdd(OpType).Add(UserOpCallbackData{ NewCallbackId, Callback });
+	CallbackTable[GetCallbackTableIndex(ComponentId, OpType)].Add(UserOpCallbackData{ NewCallbackId, Callback });
 	CallbackIdToDataMap.Add(NewCallbackId, CallbackIdData{ ComponentId, OpType });
 	return NewCallbackId;
 }
 
 bool USpatialDispatcher::RemoveOpCallback(FCallbackId CallbackId)
 {
-	CallbackIdData* CallbackData = CallbackIdToDataMap.Find(CallbackId);
+	const CallbackIdData* CallbackData = CallbackIdToDataMap.Find(CallbackId);
 	if (CallbackData == nullptr)
 	{
 		return false;
 	}
 
-	OpTypeToCallbacksMap* OpTypesToCallbacks = ComponentOpTypeToCallbacksMap.Find(CallbackData->ComponentId);
-	if (OpTypesToCallbacks == nullptr)
-	{
-		return false;
-	}
+	TArray<UserOpCallbackData>& ComponentCallbacks = CallbackTable[GetCallbackTableIndex(CallbackData->ComponentId, CallbackData->OpType)];
 
-	TArray<UserOpCallbackData>* ComponentCallbacks = OpTypesToCallbacks->Find(CallbackData->OpType);
-	if (ComponentCallbacks == nullptr)
-	{
-		return false;
-	}
-
-	int32 CallbackIndex = ComponentCallbacks->IndexOfByPredicate([CallbackId](const UserOpCallbackData& Data)
+	int32 CallbackIndex = ComponentCallbacks.IndexOfByPredicate([CallbackId](const UserOpCallbackData& Data)
 	{
 		return Data.Id == CallbackId;
 	});
-	if (CallbackIndex == INDEX_NONE)
+	if (!ensureMsgf(CallbackIndex != INDEX_NONE, TEXT("Op callback %u is registered for component %u but missing from the callback table."), CallbackId, CallbackData->ComponentId))
 	{
 		return false;
 	}
 
-	// If removing the only callback for a component ID / op type, delete map entries as applicable
-	if (ComponentCallbacks->Num() == 1)
-	{
-		if (OpTypesToCallbacks->Num() == 1)
-		{
-			ComponentOpTypeToCallbacksMap.Remove(CallbackData->ComponentId);
-			return true;
-		}
-		OpTypesToCallbacks->Remove(CallbackData->OpType);
-		return true;
-	}
-
-	ComponentCallbacks->RemoveAt(CallbackIndex);
+	ComponentCallbacks.RemoveAt(CallbackIndex);
+	CallbackIdToDataMap.Remove(CallbackId);
 	return true;
 }
 
 void USpatialDispatcher::RunCallbacks(Worker_ComponentId ComponentId, const Worker_Op* Op)
 {
-	OpTypeToCallbacksMap* OpTypeCallbacks = ComponentOpTypeToCallbacksMap.Find(ComponentId);
-	if (OpTypeCallbacks == nullptr)
+	if (CallbackTable.Num() == 0)
 	{
 		return;
 	}
 
-	TArray<UserOpCallbackData>* ComponentCallbacks = OpTypeCallbacks->Find(static_cast<Worker_OpType>(Op->op_type));
-	if (ComponentCallbacks == nullptr)
-	{
-		return;
-	}
+	const TArray<UserOpCallbackData>& ComponentCallbacks = CallbackTable[GetCallbackTableIndex(ComponentId, static_cast<Worker_OpType>(Op->op_type))];
 
-	for (UserOpCallbackData CallbackData : *ComponentCallbacks)
+	for (UserOpCallbackData CallbackData : ComponentCallbacks)
 	{
 		CallbackData.Callback(Op);
 	}
 }
 
+int32 USpatialDispatcher::GetCallbackTableIndex(Worker_ComponentId ComponentId, Worker_OpType OpType)
+{
+	return (ComponentId - SpatialConstants::MIN_EXTERNAL_SCHEMA_ID) * NUM_CALLBACK_OP_TYPES + GetCallbackOpTypeIndex(OpType);
+}
+
 void USpatialDispatcher::MarkOpToSkip(const Worker_Op* Op)
 {
 	OpsToSkip.Add(Op);
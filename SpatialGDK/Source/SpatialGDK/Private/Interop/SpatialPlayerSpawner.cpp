@@ -11,6 +11,7 @@
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/SpatialReceiver.h"
 #include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/SchemaUtils.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
@@ -20,56 +21,149 @@ DEFINE_LOG_CATEGORY(LogSpatialPlayerSpawner);
 
 using namespace SpatialGDK;
 
+namespace
+{
+	void SendPlayerSpawnSuccessResponse(USpatialWorkerConnection* Connection, Worker_RequestId RequestId)
+	{
+		Worker_CommandResponse CommandResponse = {};
+		CommandResponse.component_id = SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID;
+		CommandResponse.schema_type = Schema_CreateCommandResponse(SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID, 1);
+
+		Connection->SendCommandResponse(RequestId, &CommandResponse);
+	}
+}
+
 void USpatialPlayerSpawner::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager)
 {
 	NetDriver = InNetDriver;
 	TimerManager = InTimerManager;
 
 	NumberOfAttempts = 0;
+	bSpawnerEntityIdsQueried = false;
 }
 
-void USpatialPlayerSpawner::ReceivePlayerSpawnRequest(Schema_Object* Payload, const char* CallerAttribute, Worker_RequestId RequestId )
+void USpatialPlayerSpawner::ReceivePlayerSpawnRequest(Schema_Object* Payload, const char* CallerAttribute, Worker_RequestId RequestId, Worker_EntityId SpawnerEntityId)
 {
 	FString Attributes = FString{ UTF8_TO_TCHAR(CallerAttribute) };
 
+	// A client that retried while its player is still queued gets its response once the player is accepted.
+	if (TArray<Worker_RequestId>* PendingRequestIds = PendingPlayerSpawnRequestIds.Find(Attributes))
+	{
+		PendingRequestIds->Add(RequestId);
+		return;
+	}
+
 	bool bAlreadyHasPlayer;
 	WorkersWithPlayersSpawned.Emplace(Attributes, &bAlreadyHasPlayer);
 
-	// Accept the player if we have not already accepted a player from this worker.
-	if (!bAlreadyHasPlayer)
+	// The player from this worker has already been accepted.
+	if (bAlreadyHasPlayer)
+	{
+		SendPlayerSpawnSuccessResponse(NetDriver->Connection, RequestId);
+		return;
+	}
+
+	// Admit the player, it's accepted and responded to in ProcessPendingPlayerSpawns.
 	{
 		// Extract spawn parameters.
-		FString URLString = GetStringFromSchema(Payload, 1);
+		PendingPlayerSpawns.AddDefaulted();
+		FPendingPlayerSpawn& PendingPlayerSpawn = PendingPlayerSpawns.Last();
+		PendingPlayerSpawn.WorkerAttribute = Attributes;
+		PendingPlayerSpawn.SpawnerEntityId = SpawnerEntityId;
+		PendingPlayerSpawn.URLString = GetStringFromSchema(Payload, 1);
 
-		FUniqueNetIdRepl UniqueId;
 		TArray<uint8> UniqueIdBytes = GetBytesFromSchema(Payload, 2);
 		FNetBitReader UniqueIdReader(nullptr, UniqueIdBytes.GetData(), UniqueIdBytes.Num() * 8);
-		UniqueIdReader << UniqueId;
+		UniqueIdReader << PendingPlayerSpawn.UniqueId;
 
-		FName OnlinePlatformName = FName(*GetStringFromSchema(Payload, 3));
+		PendingPlayerSpawn.OnlinePlatformName = FName(*GetStringFromSchema(Payload, 3));
 		bool bSimulatedPlayer = Schema_GetBool(Payload, 4);
 
-		URLString.Append(TEXT("?workerAttribute=")).Append(Attributes);
+		PendingPlayerSpawn.URLString.Append(TEXT("?workerAttribute=")).Append(Attributes);
 		if (bSimulatedPlayer)
 		{
-			URLString += TEXT("?simulatedPlayer=1");
+			PendingPlayerSpawn.URLString += TEXT("?simulatedPlayer=1");
 		}
-		
-		NetDriver->AcceptNewPlayer(FURL(nullptr, *URLString, TRAVEL_Absolute), UniqueId, OnlinePlatformName, false);
+
+		PendingPlayerSpawnRequestIds.Add(Attributes).Add(RequestId);
 	}
+}
 
-	// Send a successful response if the player has been accepted, either from this request or one in the past.
-	Worker_CommandResponse CommandResponse = {};
-	CommandResponse.component_id = SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID;
-	CommandResponse.schema_type = Schema_CreateCommandResponse(SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID, 1);
-	Schema_Object* ResponseObject = Schema_GetCommandResponseObject(CommandResponse.schema_type);
+void USpatialPlayerSpawner::ProcessPendingPlayerSpawns()
+{
+	if (PendingPlayerSpawns.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 PlayerSpawnsPerTick = GetDefault<USpatialGDKSettings>()->PlayerSpawnsPerTick;
+	const int32 NumToSpawn = PlayerSpawnsPerTick > 0 ? FMath::Min(PlayerSpawnsPerTick, PendingPlayerSpawns.Num()) : PendingPlayerSpawns.Num();
+
+	for (int32 i = 0; i < NumToSpawn; i++)
+	{
+		const FPendingPlayerSpawn& PendingPlayerSpawn = PendingPlayerSpawns[i];
+		NetDriver->AcceptNewPlayer(FURL(nullptr, *PendingPlayerSpawn.URLString, TRAVEL_Absolute), PendingPlayerSpawn.UniqueId, PendingPlayerSpawn.OnlinePlatformName, false);
+
+		TArray<Worker_RequestId> RequestIds;
+		PendingPlayerSpawnRequestIds.RemoveAndCopyValue(PendingPlayerSpawn.WorkerAttribute, RequestIds);
+		for (Worker_RequestId RequestId : RequestIds)
+		{
+			SendPlayerSpawnSuccessResponse(NetDriver->Connection, RequestId);
+		}
+	}
 
-	NetDriver->Connection->SendCommandResponse(RequestId, &CommandResponse);
+	PendingPlayerSpawns.RemoveAt(0, NumToSpawn, false);
+	NetDriver->GetCounters().Increment(ESpatialCounter::PlayerLoginsAccepted, NumToSpawn);
+
+	UE_LOG(LogSpatialPlayerSpawner, Verbose, TEXT("Accepted %d players, %d still waiting."), NumToSpawn, PendingPlayerSpawns.Num());
+}
+
+void USpatialPlayerSpawner::FailPendingPlayerSpawns(Worker_EntityId SpawnerEntityId, const FString& Reason)
+{
+	const int32 NumPending = PendingPlayerSpawns.Num();
+	PendingPlayerSpawns.RemoveAll([this, SpawnerEntityId, &Reason](const FPendingPlayerSpawn& PendingPlayerSpawn)
+	{
+		if (SpawnerEntityId != SpatialConstants::INVALID_ENTITY_ID && PendingPlayerSpawn.SpawnerEntityId != SpawnerEntityId)
+		{
+			return false;
+		}
+
+		// Forget the worker, so its retry is admitted again wherever it ends up.
+		WorkersWithPlayersSpawned.Remove(PendingPlayerSpawn.WorkerAttribute);
+
+		TArray<Worker_RequestId> RequestIds;
+		PendingPlayerSpawnRequestIds.RemoveAndCopyValue(PendingPlayerSpawn.WorkerAttribute, RequestIds);
+		for (Worker_RequestId RequestId : RequestIds)
+		{
+			NetDriver->Connection->SendCommandFailure(RequestId, Reason);
+		}
+		return true;
+	});
+
+	if (PendingPlayerSpawns.Num() < NumPending)
+	{
+		UE_LOG(LogSpatialPlayerSpawner, Warning, TEXT("Failed %d queued player spawns: %s"), NumPending - PendingPlayerSpawns.Num(), *Reason);
+	}
 }
 
 void USpatialPlayerSpawner::SendPlayerSpawnRequest()
 {
-	// Send an entity query for the SpatialSpawner and bind a delegate so that once it's found, we send a spawn command.
+	++NumberOfAttempts;
+
+	// The snapshot always puts the first spawner at a well known entity ID, so without sharding there's nothing to look up.
+	// If sending to it fails, the spawners are queried for instead.
+	if (CachedSpawnerEntityIds.Num() == 0 && !bSpawnerEntityIdsQueried && GetDefault<USpatialGDKSettings>()->PlayerSpawnerShardCount <= 1)
+	{
+		CachedSpawnerEntityIds.Add(SpatialConstants::INITIAL_SPAWNER_ENTITY_ID);
+	}
+
+	if (CachedSpawnerEntityIds.Num() > 0)
+	{
+		SendPlayerSpawnCommand(ChooseSpawnerEntityId());
+		return;
+	}
+
+	// Send an entity query for the SpatialSpawners and bind a delegate so that once they're found, we send a spawn command.
 	Worker_Constraint SpatialSpawnerConstraint;
 	SpatialSpawnerConstraint.constraint_type = WORKER_CONSTRAINT_TYPE_COMPONENT;
 	SpatialSpawnerConstraint.component_constraint.component_id = SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID;
@@ -94,37 +188,54 @@ void USpatialPlayerSpawner::SendPlayerSpawnRequest()
 		}
 		else
 		{
-			checkf(Op.result_count == 1, TEXT("There should never be more than one SpatialSpawner entity."));
-
-			// Construct and send the player spawn request.
-			FURL LoginURL;
-			FUniqueNetIdRepl UniqueId;
-			FName OnlinePlatformName;
-			ObtainPlayerParams(LoginURL, UniqueId, OnlinePlatformName);
-
-			Worker_CommandRequest CommandRequest = {};
-			CommandRequest.component_id = SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID;
-			CommandRequest.schema_type = Schema_CreateCommandRequest(SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID, 1);
-			Schema_Object* RequestObject = Schema_GetCommandRequestObject(CommandRequest.schema_type);
-			AddStringToSchema(RequestObject, 1, LoginURL.ToString(true));
-
-			// Write player identity information.
-			FNetBitWriter UniqueIdWriter(0);
-			UniqueIdWriter << UniqueId;
-			AddBytesToSchema(RequestObject, 2, UniqueIdWriter);
-			AddStringToSchema(RequestObject, 3, OnlinePlatformName.ToString());
-			UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(NetDriver);
-			bool bSimulatedPlayer = GameInstance ? GameInstance->IsSimulatedPlayer() : false;
-			Schema_AddBool(RequestObject, 4, bSimulatedPlayer);
-
-			NetDriver->Connection->SendCommandRequest(Op.results[0].entity_id, &CommandRequest, 1);
+			CachedSpawnerEntityIds.Reset(Op.result_count);
+			for (uint32 i = 0; i < Op.result_count; i++)
+			{
+				CachedSpawnerEntityIds.Add(Op.results[i].entity_id);
+			}
+			CachedSpawnerEntityIds.Sort();
+			bSpawnerEntityIdsQueried = true;
+
+			SendPlayerSpawnCommand(ChooseSpawnerEntityId());
 		}
 	});
 
-	UE_LOG(LogSpatialPlayerSpawner, Log, TEXT("Sending player spawn request"));
+	UE_LOG(LogSpatialPlayerSpawner, Log, TEXT("Querying for SpatialSpawner entities"));
 	NetDriver->Receiver->AddEntityQueryDelegate(RequestID, SpatialSpawnerQueryDelegate);
+}
 
-	++NumberOfAttempts;
+Worker_EntityId USpatialPlayerSpawner::ChooseSpawnerEntityId() const
+{
+	// Spread clients over the spawner shards, always picking the same one for a worker so retries go to the same server.
+	const uint32 ShardIndex = GetTypeHash(NetDriver->Connection->GetWorkerId()) % static_cast<uint32>(CachedSpawnerEntityIds.Num());
+	return CachedSpawnerEntityIds[ShardIndex];
+}
+
+void USpatialPlayerSpawner::SendPlayerSpawnCommand(Worker_EntityId SpawnerEntityId)
+{
+	// Construct and send the player spawn request.
+	FURL LoginURL;
+	FUniqueNetIdRepl UniqueId;
+	FName OnlinePlatformName;
+	ObtainPlayerParams(LoginURL, UniqueId, OnlinePlatformName);
+
+	Worker_CommandRequest CommandRequest = {};
+	CommandRequest.component_id = SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID;
+	CommandRequest.schema_type = Schema_CreateCommandRequest(SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID, 1);
+	Schema_Object* RequestObject = Schema_GetCommandRequestObject(CommandRequest.schema_type);
+	AddStringToSchema(RequestObject, 1, LoginURL.ToString(true));
+
+	// Write player identity information.
+	FNetBitWriter UniqueIdWriter(0);
+	UniqueIdWriter << UniqueId;
+	AddBytesToSchema(RequestObject, 2, UniqueIdWriter);
+	AddStringToSchema(RequestObject, 3, OnlinePlatformName.ToString());
+	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(NetDriver);
+	bool bSimulatedPlayer = GameInstance ? GameInstance->IsSimulatedPlayer() : false;
+	Schema_AddBool(RequestObject, 4, bSimulatedPlayer);
+
+	UE_LOG(LogSpatialPlayerSpawner, Log, TEXT("Sending player spawn request to spawner entity %lld"), SpawnerEntityId);
+	NetDriver->Connection->SendCommandRequest(SpawnerEntityId, &CommandRequest, 1);
 }
 
 void USpatialPlayerSpawner::ReceivePlayerSpawnResponse(const Worker_CommandResponseOp& Op)
@@ -138,6 +249,18 @@ void USpatialPlayerSpawner::ReceivePlayerSpawnResponse(const Worker_CommandRespo
 		UE_LOG(LogSpatialPlayerSpawner, Warning, TEXT("Player spawn request failed: \"%s\""),
 			UTF8_TO_TCHAR(Op.message));
 
+		// The cached entity isn't a spawner (anymore), so look the spawners up again on the next attempt.
+		if (Op.status_code == WORKER_STATUS_CODE_NOT_FOUND || Op.status_code == WORKER_STATUS_CODE_PERMISSION_DENIED)
+		{
+			CachedSpawnerEntityIds.Reset();
+			bSpawnerEntityIdsQueried = false;
+			if (GetDefault<USpatialGDKSettings>()->PlayerSpawnerShardCount <= 1 && Op.entity_id == SpatialConstants::INITIAL_SPAWNER_ENTITY_ID)
+			{
+				// Don't go back to the well known entity ID, it's not the spawner in this snapshot.
+				bSpawnerEntityIdsQueried = true;
+			}
+		}
+
 		FTimerHandle RetryTimer;
 		TimerManager->SetTimer(RetryTimer, [WeakThis = TWeakObjectPtr<USpatialPlayerSpawner>(this)]()
 		{
@@ -6,7 +6,7 @@
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
-#include "TimerManager.h"
+#include "Misc/PackageName.h"
 
 #include "EngineClasses/SpatialActorChannel.h"
 #include "EngineClasses/SpatialFastArrayNetSerialize.h"
@@ -25,15 +25,17 @@
 #include "Schema/UnrealMetadata.h"
 #include "SpatialConstants.h"
 #include "Utils/ComponentReader.h"
+#include "Utils/CrossServerRPCSendBuffer.h"
 #include "Utils/ErrorCodeRemapping.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialMetrics.h"
+#include "Utils/TimingWheel.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialReceiver);
 
 using namespace SpatialGDK;
 
-void USpatialReceiver::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager)
+void USpatialReceiver::Init(USpatialNetDriver* InNetDriver, FTimingWheel* InTimingWheel)
 {
 	NetDriver = InNetDriver;
 	StaticComponentView = InNetDriver->StaticComponentView;
@@ -41,7 +43,12 @@ void USpatialReceiver::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTim
 	PackageMap = InNetDriver->PackageMap;
 	ClassInfoManager = InNetDriver->ClassInfoManager;
 	GlobalStateManager = InNetDriver->GlobalStateManager;
-	TimerManager = InTimerManager;
+	TimingWheel = InTimingWheel;
+
+	if (!NetDriver->IsServer())
+	{
+		ActorPool.Init();
+	}
 }
 
 void USpatialReceiver::OnCriticalSection(bool InCriticalSection)
@@ -68,9 +75,29 @@ void USpatialReceiver::LeaveCriticalSection()
 	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Leaving critical section."));
 	check(bInCriticalSection);
 
+	// Entities this worker is authoritative over are never queued, the local player's own Actors shouldn't wait behind others.
+	TSet<Worker_EntityId_Key> AuthoritativeEntities;
+	if (!NetDriver->IsServer() && GetDefault<USpatialGDKSettings>()->ClientEntitySpawnBudgetMs > 0.0f)
+	{
+		for (const Worker_AuthorityChangeOp& PendingAuthorityChange : PendingAuthorityChanges)
+		{
+			if (PendingAuthorityChange.authority == WORKER_AUTHORITY_AUTHORITATIVE)
+			{
+				AuthoritativeEntities.Add(PendingAuthorityChange.entity_id);
+			}
+		}
+	}
+
 	for (Worker_EntityId& PendingAddEntity : PendingAddEntities)
 	{
-		ReceiveActor(PendingAddEntity);
+		if (ShouldQueueSpawn(PendingAddEntity, AuthoritativeEntities))
+		{
+			QueueSpawn(PendingAddEntity);
+		}
+		else
+		{
+			ReceiveActor(PendingAddEntity);
+		}
 	}
 
 	for (Worker_AuthorityChangeOp& PendingAuthorityChange : PendingAuthorityChanges)
@@ -78,6 +105,19 @@ void USpatialReceiver::LeaveCriticalSection()
 		HandleActorAuthority(PendingAuthorityChange);
 	}
 
+	// Authority has been resolved by now, so stop receiving heartbeats for PlayerControllers checked out by this server
+	// that it isn't responsible for. They'd otherwise be sent to every server with the PlayerController in view (UNR-986).
+	if (NetDriver->IsServer() && !GetDefault<USpatialGDKSettings>()->bEnableHeartbeatInterestForNonAuthoritativeServers)
+	{
+		for (Worker_EntityId& PendingAddEntity : PendingAddEntities)
+		{
+			if (StaticComponentView->HasComponent(PendingAddEntity, SpatialConstants::HEARTBEAT_COMPONENT_ID) && !HeartbeatTracker.Contains(PendingAddEntity))
+			{
+				SetHeartbeatInterest(PendingAddEntity, false);
+			}
+		}
+	}
+
 	// Mark that we've left the critical section.
 	bInCriticalSection = false;
 	PendingAddEntities.Empty();
@@ -133,6 +173,12 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 	case SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID:
 		GlobalStateManager->ApplyStartupActorManagerData(Op.data);
 		return;
+	case SpatialConstants::CROSS_SERVER_RPC_SENDER_COMPONENT_ID:
+		ProcessCrossServerRPCBatches(Op.entity_id, Schema_GetComponentDataFields(Op.data.schema_type));
+		return;
+	case SpatialConstants::CROSS_SERVER_RPC_ACKS_COMPONENT_ID:
+		OnCrossServerRPCAcksChanged(Op.entity_id);
+		return;
 	}
 
 	if (ClassInfoManager->IsSublevelComponent(Op.data.component_id))
@@ -142,7 +188,11 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 
 	if (bInCriticalSection)
 	{
-		PendingAddComponents.Emplace(Op.entity_id, Op.data.component_id, MakeUnique<DynamicComponent>(Op.data));
+		PendingAddComponents.FindOrAdd(Op.entity_id).Emplace(Op.entity_id, Op.data.component_id, MakeUnique<DynamicComponent>(Op.data));
+	}
+	else if (FParkedEntity* ParkedEntity = ParkedEntities.Find(Op.entity_id))
+	{
+		ParkedEntity->PendingAddComponents.Emplace(Op.entity_id, Op.data.component_id, MakeUnique<DynamicComponent>(Op.data));
 	}
 	else
 	{
@@ -152,6 +202,11 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 
 void USpatialReceiver::OnRemoveEntity(const Worker_RemoveEntityOp& Op)
 {
+	Sender->ClearLastSentInterest(Op.entity_id);
+
+	// Nothing was spawned for it yet, the pending class load or spawn will skip it.
+	ParkedEntities.Remove(Op.entity_id);
+
 	RemoveActor(Op.entity_id);
 }
 
@@ -163,29 +218,34 @@ void USpatialReceiver::OnRemoveComponent(const Worker_RemoveComponentOp& Op)
 	// So we queue RemoveComponentOps then process the RemoveEntityOps normally, and then apply the
 	// RemoveComponentOps in ProcessRemoveComponent. Any RemoveComponentOps that relate to delete entities
 	// will be dropped in ProcessRemoveComponent.
+	if (Op.component_id == SpatialConstants::CROSS_SERVER_RPC_SENDER_COMPONENT_ID)
+	{
+		if (LocalCrossServerRPCAcks.SenderAcks.Remove(Op.entity_id) > 0)
+		{
+			bCrossServerRPCAcksDirty = true;
+		}
+	}
+	else if (Op.component_id == SpatialConstants::CROSS_SERVER_RPC_ACKS_COMPONENT_ID)
+	{
+		Sender->OnCrossServerRPCAcksRemoved(Op.entity_id);
+	}
+
 	QueuedRemoveComponentOps.Add(Op);
 }
 
 void USpatialReceiver::FlushRemoveComponentOps()
 {
-	for (const auto& Op : QueuedRemoveComponentOps)
+	QueuedRemoveComponentOps.ForEach([this](const Worker_RemoveComponentOp& Op)
 	{
 		ProcessRemoveComponent(Op);
-	}
+	});
 
-	QueuedRemoveComponentOps.Empty();
+	QueuedRemoveComponentOps.Reset();
 }
 
 void USpatialReceiver::RemoveComponentOpsForEntity(Worker_EntityId EntityId)
 {
-	for (auto& RemoveComponentOp : QueuedRemoveComponentOps)
-	{
-		if (RemoveComponentOp.entity_id == EntityId)
-		{
-			// Zero component op to prevent array resize
-			RemoveComponentOp = Worker_RemoveComponentOp{};
-		}
-	}
+	QueuedRemoveComponentOps.RemoveEntity(EntityId);
 }
 
 void USpatialReceiver::ProcessRemoveComponent(const Worker_RemoveComponentOp& Op)
@@ -195,6 +255,14 @@ void USpatialReceiver::ProcessRemoveComponent(const Worker_RemoveComponentOp& Op
 		return;
 	}
 
+	if (FParkedEntity* ParkedEntity = ParkedEntities.Find(Op.entity_id))
+	{
+		ParkedEntity->PendingAddComponents.RemoveAll([&Op](const PendingAddComponentWrapper& PendingAddComponent)
+		{
+			return PendingAddComponent.ComponentId == Op.component_id;
+		});
+	}
+
 	if (AActor* Actor = Cast<AActor>(PackageMap->GetObjectFromEntityId(Op.entity_id).Get()))
 	{
 		if (UObject* Object = PackageMap->GetObjectFromUnrealObjectRef(FUnrealObjectRef(Op.entity_id, Op.component_id)).Get())
@@ -246,16 +314,18 @@ void USpatialReceiver::HandlePlayerLifecycleAuthority(const Worker_AuthorityChan
 			{
 				if (NetDriver->IsServer())
 				{
-					AuthorityPlayerControllerConnectionMap.Add(Op.entity_id, Connection);
+					HeartbeatTracker.Add(Op.entity_id, Connection, NetDriver->Time);
+					SetHeartbeatInterest(Op.entity_id, true);
 				}
-				Connection->InitHeartbeat(TimerManager, Op.entity_id);
+				Connection->InitHeartbeat(TimingWheel, Op.entity_id);
 			}
 		}
 		else if (Op.authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE)
 		{
 			if (NetDriver->IsServer())
 			{
-				AuthorityPlayerControllerConnectionMap.Remove(Op.entity_id);
+				HeartbeatTracker.Remove(Op.entity_id);
+				SetHeartbeatInterest(Op.entity_id, false);
 			}
 			if (USpatialNetConnection* Connection = Cast<USpatialNetConnection>(PlayerController->GetNetConnection()))
 			{
@@ -269,12 +339,29 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 {
 	StaticComponentView->OnAuthorityChange(Op);
 
+	if (FParkedEntity* ParkedEntity = ParkedEntities.Find(Op.entity_id))
+	{
+		ParkedEntity->PendingAuthorityChanges.Add(Op);
+		return;
+	}
+
 	if (GlobalStateManager->HandlesComponent(Op.component_id))
 	{
 		GlobalStateManager->AuthorityChanged(Op);
 		return;
 	}
 
+	if (Op.component_id == SpatialConstants::INTEREST_COMPONENT_ID && Op.authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE)
+	{
+		// Another worker may change the entity's Interest while we're not authoritative.
+		Sender->ClearLastSentInterest(Op.entity_id);
+	}
+
+	if (Op.component_id == SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID && Op.authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE)
+	{
+		NetDriver->PlayerSpawner->FailPendingPlayerSpawns(Op.entity_id, TEXT("The server lost authority over the player spawner before the player was accepted."));
+	}
+
 	AActor* Actor = Cast<AActor>(NetDriver->PackageMap->GetObjectFromEntityId(Op.entity_id));
 	if (Actor == nullptr)
 	{
@@ -423,11 +510,16 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 
 bool USpatialReceiver::IsReceivedEntityTornOff(Worker_EntityId EntityId)
 {
+	TArray<PendingAddComponentWrapper>* EntityPendingAddComponents = PendingAddComponents.Find(EntityId);
+	if (EntityPendingAddComponents == nullptr)
+	{
+		return false;
+	}
+
 	// Check the pending add components, to find the root component for the received entity.
-	for (PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
+	for (PendingAddComponentWrapper& PendingAddComponent : *EntityPendingAddComponents)
 	{
-		if (PendingAddComponent.EntityId != EntityId
-			|| ClassInfoManager->GetCategoryByComponentId(PendingAddComponent.ComponentId) != SCHEMA_Data)
+		if (ClassInfoManager->GetCategoryByComponentId(PendingAddComponent.ComponentId) != SCHEMA_Data)
 		{
 			continue;
 		}
@@ -446,6 +538,253 @@ bool USpatialReceiver::IsReceivedEntityTornOff(Worker_EntityId EntityId)
 	return false;
 }
 
+bool USpatialReceiver::ShouldLoadClassAsync(UnrealMetadata* UnrealMetadataComp) const
+{
+	// Stably named Actors are found rather than spawned, so they never need their class loaded.
+	if (!GetDefault<USpatialGDKSettings>()->bAsyncLoadNewActorClasses || UnrealMetadataComp->StablyNamedRef.IsSet() || UnrealMetadataComp->NativeClass.IsValid())
+	{
+		return false;
+	}
+
+	if (FindObject<UClass>(nullptr, *UnrealMetadataComp->ClassPath, false) != nullptr)
+	{
+		return false;
+	}
+
+	// If the package is already in memory without the class, loading it again won't help, so leave it to the synchronous path to fail.
+	const FString PackagePath = FPackageName::ObjectPathToPackageName(UnrealMetadataComp->ClassPath);
+	return ClassPackagesLoading.Contains(FName(*PackagePath)) || FindObject<UPackage>(nullptr, *PackagePath) == nullptr;
+}
+
+void USpatialReceiver::ParkEntityUntilClassLoaded(Worker_EntityId EntityId, const FString& ClassPath)
+{
+	const FString PackagePath = FPackageName::ObjectPathToPackageName(ClassPath);
+	const FName PackageName(*PackagePath);
+
+	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Entity %lld is waiting on class %s to be loaded before it's spawned."), EntityId, *ClassPath);
+
+	FParkedEntity& ParkedEntity = ParkedEntities.Add(EntityId);
+	ParkedEntity.PackageName = PackageName;
+	if (TArray<PendingAddComponentWrapper>* EntityPendingAddComponents = PendingAddComponents.Find(EntityId))
+	{
+		ParkedEntity.PendingAddComponents = MoveTemp(*EntityPendingAddComponents);
+	}
+
+	TArray<Worker_EntityId>& WaitingEntities = ClassPackagesLoading.FindOrAdd(PackageName);
+	WaitingEntities.Add(EntityId);
+
+	// Only the first entity to need the package starts loading it.
+	if (WaitingEntities.Num() == 1)
+	{
+		LoadPackageAsync(PackagePath, FLoadPackageAsyncDelegate::CreateUObject(this, &USpatialReceiver::OnClassPackageLoaded));
+	}
+}
+
+void USpatialReceiver::OnClassPackageLoaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+{
+	// This can be called from inside a flush of async loading while ops are being processed,
+	// so spawning is left to ProcessCompletedClassLoads.
+	CompletedClassPackageLoads.Emplace(PackageName, Result == EAsyncLoadingResult::Succeeded);
+}
+
+void USpatialReceiver::ProcessCompletedClassLoads()
+{
+	if (CompletedClassPackageLoads.Num() == 0)
+	{
+		return;
+	}
+
+	check(!bInCriticalSection);
+
+	TArray<TPair<FName, bool>> CompletedLoads = MoveTemp(CompletedClassPackageLoads);
+	CompletedClassPackageLoads.Reset();
+
+	for (const TPair<FName, bool>& CompletedLoad : CompletedLoads)
+	{
+		TArray<Worker_EntityId> WaitingEntities;
+		if (!ClassPackagesLoading.RemoveAndCopyValue(CompletedLoad.Key, WaitingEntities))
+		{
+			continue;
+		}
+
+		for (Worker_EntityId EntityId : WaitingEntities)
+		{
+			const FParkedEntity* WaitingEntity = ParkedEntities.Find(EntityId);
+			if (WaitingEntity == nullptr || WaitingEntity->PackageName != CompletedLoad.Key)
+			{
+				// Removed from view while loading, or removed and checked out again waiting on something else.
+				continue;
+			}
+
+			FParkedEntity ParkedEntity;
+			ParkedEntities.RemoveAndCopyValue(EntityId, ParkedEntity);
+
+			if (!CompletedLoad.Value)
+			{
+				UE_LOG(LogSpatialReceiver, Warning, TEXT("The class package %s for entity %lld couldn't be loaded. The actor will not be spawned."), *CompletedLoad.Key.ToString(), EntityId);
+				continue;
+			}
+
+			SpawnParkedEntity(EntityId, ParkedEntity);
+		}
+	}
+
+	ProcessQueuedResolvedObjects();
+}
+
+int32 USpatialReceiver::GetNumEntitiesAwaitingClassLoad() const
+{
+	int32 NumEntities = 0;
+	for (const TPair<Worker_EntityId_Key, FParkedEntity>& ParkedEntity : ParkedEntities)
+	{
+		if (ParkedEntity.Value.PackageName != NAME_None)
+		{
+			NumEntities++;
+		}
+	}
+	return NumEntities;
+}
+
+bool USpatialReceiver::ShouldQueueSpawn(Worker_EntityId EntityId, const TSet<Worker_EntityId_Key>& AuthoritativeEntities) const
+{
+	if (NetDriver->IsServer() || GetDefault<USpatialGDKSettings>()->ClientEntitySpawnBudgetMs <= 0.0f || AuthoritativeEntities.Contains(EntityId))
+	{
+		return false;
+	}
+
+	// Only queue entities that will actually spawn a new Actor, stably named and already linked Actors are cheap to resolve.
+	UnrealMetadata* UnrealMetadataComp = StaticComponentView->GetComponentData<UnrealMetadata>(EntityId);
+	if (UnrealMetadataComp == nullptr || UnrealMetadataComp->StablyNamedRef.IsSet())
+	{
+		return false;
+	}
+
+	return PackageMap->GetObjectFromEntityId(EntityId) == nullptr;
+}
+
+void USpatialReceiver::QueueSpawn(Worker_EntityId EntityId)
+{
+	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Queueing entity %lld to be spawned within the spawn budget."), EntityId);
+
+	FParkedEntity& ParkedEntity = ParkedEntities.Add(EntityId);
+	if (TArray<PendingAddComponentWrapper>* EntityPendingAddComponents = PendingAddComponents.Find(EntityId))
+	{
+		ParkedEntity.PendingAddComponents = MoveTemp(*EntityPendingAddComponents);
+	}
+
+	QueuedSpawnEntities.Add(EntityId);
+}
+
+void USpatialReceiver::SpawnParkedEntity(Worker_EntityId EntityId, FParkedEntity& ParkedEntity)
+{
+	// Spawn the Actor with the components received so far as its initial state, then catch up on everything received since.
+	PendingAddComponents.Add(EntityId, MoveTemp(ParkedEntity.PendingAddComponents));
+	ReceiveActor(EntityId);
+	PendingAddComponents.Remove(EntityId);
+
+	// A queued entity can still need its class loaded, so hand what was held back over to the new parked entry.
+	if (FParkedEntity* ReparkedEntity = ParkedEntities.Find(EntityId))
+	{
+		ReparkedEntity->PendingAuthorityChanges = MoveTemp(ParkedEntity.PendingAuthorityChanges);
+		ReparkedEntity->PendingUpdates = MoveTemp(ParkedEntity.PendingUpdates);
+		return;
+	}
+
+	for (const Worker_AuthorityChangeOp& PendingAuthorityChange : ParkedEntity.PendingAuthorityChanges)
+	{
+		HandleActorAuthority(PendingAuthorityChange);
+	}
+
+	for (const TUniquePtr<FParkedComponentUpdate>& PendingUpdate : ParkedEntity.PendingUpdates)
+	{
+		Worker_ComponentUpdateOp UpdateOp{};
+		UpdateOp.entity_id = EntityId;
+		UpdateOp.update = *PendingUpdate->Update;
+		OnComponentUpdate(UpdateOp);
+	}
+}
+
+bool USpatialReceiver::GetSpawnPriorityLocation(FVector& OutLocation) const
+{
+	APlayerController* PlayerController = NetDriver->GetWorld()->GetFirstPlayerController();
+	if (PlayerController == nullptr)
+	{
+		return false;
+	}
+
+	FRotator ViewRotation;
+	PlayerController->GetPlayerViewPoint(OutLocation, ViewRotation);
+	return true;
+}
+
+void USpatialReceiver::ProcessQueuedSpawns()
+{
+	if (QueuedSpawnEntities.Num() == 0)
+	{
+		return;
+	}
+
+	check(!bInCriticalSection);
+
+	FVector ViewLocation;
+	if (GetSpawnPriorityLocation(ViewLocation))
+	{
+		const FIntVector& OriginLocation = NetDriver->GetWorld()->OriginLocation;
+
+		// Positions are kept up to date in the static component view while entities are queued, so they're looked up on every call.
+		TMap<Worker_EntityId_Key, float> DistancesSquared;
+		DistancesSquared.Reserve(QueuedSpawnEntities.Num());
+		for (Worker_EntityId EntityId : QueuedSpawnEntities)
+		{
+			float DistanceSquared = MAX_flt;
+			if (Position* PositionComp = StaticComponentView->GetComponentData<Position>(EntityId))
+			{
+				DistanceSquared = FVector::DistSquared(FRepMovement::RebaseOntoLocalOrigin(Coordinates::ToFVector(PositionComp->Coords), OriginLocation), ViewLocation);
+			}
+			else if (SpawnData* SpawnDataComp = StaticComponentView->GetComponentData<SpawnData>(EntityId))
+			{
+				DistanceSquared = FVector::DistSquared(FRepMovement::RebaseOntoLocalOrigin(SpawnDataComp->Location, OriginLocation), ViewLocation);
+			}
+			DistancesSquared.Add(EntityId, DistanceSquared);
+		}
+
+		// Stable, so entities without a location keep the order they were checked out in.
+		QueuedSpawnEntities.StableSort([&DistancesSquared](Worker_EntityId A, Worker_EntityId B)
+		{
+			return DistancesSquared[A] < DistancesSquared[B];
+		});
+	}
+
+	const double BudgetSeconds = GetDefault<USpatialGDKSettings>()->ClientEntitySpawnBudgetMs / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	int32 NumProcessed = 0;
+	for (; NumProcessed < QueuedSpawnEntities.Num(); NumProcessed++)
+	{
+		// Always spawn at least one entity, so the queue drains however expensive the Actors are.
+		if (NumProcessed > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+
+		const Worker_EntityId EntityId = QueuedSpawnEntities[NumProcessed];
+		const FParkedEntity* QueuedEntity = ParkedEntities.Find(EntityId);
+		if (QueuedEntity == nullptr || QueuedEntity->PackageName != NAME_None)
+		{
+			// Removed from view while queued, or removed and checked out again waiting on a class load.
+			continue;
+		}
+
+		FParkedEntity ParkedEntity;
+		ParkedEntities.RemoveAndCopyValue(EntityId, ParkedEntity);
+		SpawnParkedEntity(EntityId, ParkedEntity);
+	}
+
+	QueuedSpawnEntities.RemoveAt(0, NumProcessed, false);
+
+	ProcessQueuedResolvedObjects();
+}
+
 void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 {
 	checkf(NetDriver, TEXT("We should have a NetDriver whilst processing ops."));
@@ -483,6 +822,12 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 	}
 	else
 	{
+		if (ShouldLoadClassAsync(UnrealMetadataComp))
+		{
+			ParkEntityUntilClassLoaded(EntityId, UnrealMetadataComp->ClassPath);
+			return;
+		}
+
 		UClass* Class = UnrealMetadataComp->GetNativeEntityClass();
 		if (Class == nullptr)
 		{
@@ -551,15 +896,15 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 		// Apply initial replicated properties.
 		// This was moved to after FinishingSpawning because components existing only in blueprints aren't added until spawning is complete
 		// Potentially we could split out the initial actor state and the initial component state
-		for (PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
+		if (TArray<PendingAddComponentWrapper>* EntityPendingAddComponents = PendingAddComponents.Find(EntityId))
 		{
-			if (ClassInfoManager->IsSublevelComponent(PendingAddComponent.ComponentId))
+			for (PendingAddComponentWrapper& PendingAddComponent : *EntityPendingAddComponents)
 			{
-				continue;
-			}
+				if (ClassInfoManager->IsSublevelComponent(PendingAddComponent.ComponentId))
+				{
+					continue;
+				}
 
-			if (PendingAddComponent.EntityId == EntityId)
-			{
 				ApplyComponentDataOnActorCreation(EntityId, *PendingAddComponent.Data->ComponentData, Channel);
 			}
 		}
@@ -751,6 +1096,12 @@ void USpatialReceiver::DestroyActor(AActor* Actor, Worker_EntityId EntityId)
 	// TODO: fix this with working sets (UNR-411)
 	NetDriver->StartIgnoringAuthoritativeDestruction();
 
+	if (TryReleaseActorToPool(Actor, EntityId))
+	{
+		NetDriver->StopIgnoringAuthoritativeDestruction();
+		return;
+	}
+
 	// Clean up the actor channel. For clients, this will also call destroy on the actor.
 	if (USpatialActorChannel* ActorChannel = NetDriver->GetActorChannelByEntityId(EntityId))
 	{
@@ -783,6 +1134,39 @@ void USpatialReceiver::DestroyActor(AActor* Actor, Worker_EntityId EntityId)
 	check(PackageMap->GetObjectFromEntityId(EntityId) == nullptr);
 }
 
+bool USpatialReceiver::TryReleaseActorToPool(AActor* Actor, Worker_EntityId EntityId)
+{
+	if (NetDriver->IsServer() || Actor == nullptr || Actor->IsPendingKillPending() || Actor->IsFullNameStableForNetworking() || !ActorPool.IsPooledClass(Actor->GetClass()))
+	{
+		return false;
+	}
+
+	// Dynamically attached subobjects would be left on the pooled Actor, so only pool Actors without any.
+	USpatialActorChannel* ActorChannel = NetDriver->GetActorChannelByEntityId(EntityId);
+	if (ActorChannel == nullptr || ActorChannel->CreateSubObjects.Num() > 0)
+	{
+		return false;
+	}
+
+	if (!ActorPool.Release(Actor))
+	{
+		return false;
+	}
+
+	// Detach the Actor from its channel first, otherwise closing the channel destroys it on clients.
+	ActorChannel->Connection->ActorChannels.Remove(Actor);
+	ActorChannel->Actor = nullptr;
+
+#if ENGINE_MINOR_VERSION <= 20
+	ActorChannel->ConditionalCleanUp();
+#else
+	ActorChannel->ConditionalCleanUp(false, EChannelCloseReason::Destroyed);
+#endif
+
+	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Returned actor %s for entity %lld to the actor pool."), *Actor->GetName(), EntityId);
+	return true;
+}
+
 void USpatialReceiver::CleanupDeletedEntity(Worker_EntityId EntityId)
 {
 	PackageMap->RemoveEntityActor(EntityId);
@@ -843,17 +1227,31 @@ AActor* USpatialReceiver::CreateActor(UnrealMetadata* UnrealMetadataComp, SpawnD
 		return Connection->PlayerController;
 	}
 
-	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Spawning a %s whilst checking out an entity."), *ActorClass->GetFullName());
+	FVector SpawnLocation = FRepMovement::RebaseOntoLocalOrigin(SpawnDataComp->Location, NetDriver->GetWorld()->OriginLocation);
 
-	FActorSpawnParameters SpawnInfo;
-	SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	SpawnInfo.bRemoteOwned = true;
-	SpawnInfo.bNoFail = true;
+	AActor* NewActor = nullptr;
+	if (ActorPool.IsPooledClass(ActorClass))
+	{
+		NewActor = ActorPool.Acquire(ActorClass, FTransform(SpawnDataComp->Rotation, SpawnLocation));
+		NetDriver->GetCounters().Increment(NewActor != nullptr ? ESpatialCounter::ActorPoolHits : ESpatialCounter::ActorPoolMisses);
+	}
 
-	FVector SpawnLocation = FRepMovement::RebaseOntoLocalOrigin(SpawnDataComp->Location, NetDriver->GetWorld()->OriginLocation);
+	if (NewActor != nullptr)
+	{
+		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Reusing pooled actor %s whilst checking out an entity."), *NewActor->GetName());
+	}
+	else
+	{
+		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Spawning a %s whilst checking out an entity."), *ActorClass->GetFullName());
+
+		FActorSpawnParameters SpawnInfo;
+		SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnInfo.bRemoteOwned = true;
+		SpawnInfo.bNoFail = true;
 
-	AActor* NewActor = NetDriver->GetWorld()->SpawnActorAbsolute(ActorClass, FTransform(SpawnDataComp->Rotation, SpawnLocation), SpawnInfo);
-	check(NewActor);
+		NewActor = NetDriver->GetWorld()->SpawnActorAbsolute(ActorClass, FTransform(SpawnDataComp->Rotation, SpawnLocation), SpawnInfo);
+		check(NewActor);
+	}
 
 	// Imitate the behavior in UPackageMapClient::SerializeNewActor.
 	const float Epsilon = 0.001f;
@@ -1054,6 +1452,11 @@ void USpatialReceiver::ApplyComponentData(UObject* TargetObject, USpatialActorCh
 }
 
 void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
+{
+	OnComponentUpdate(Op, nullptr);
+}
+
+void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op, TUniquePtr<RPCEndpointEvents> DecodedRPCs)
 {
 	if (StaticComponentView->GetAuthority(Op.entity_id, Op.update.component_id) == WORKER_AUTHORITY_AUTHORITATIVE)
 	{
@@ -1061,9 +1464,21 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 		return;
 	}
 
+	if (FParkedEntity* ParkedEntity = ParkedEntities.Find(Op.entity_id))
+	{
+		ParkedEntity->PendingUpdates.Add(MakeUnique<FParkedComponentUpdate>(Op.update));
+		return;
+	}
+
 	switch (Op.update.component_id)
 	{
 	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
+		// Ownership is derived from the ACL, so the replication conditions have to be rebuilt.
+		if (USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(Op.entity_id))
+		{
+			Channel->InvalidateConditionMapFilter();
+		}
+		return;
 	case SpatialConstants::METADATA_COMPONENT_ID:
 	case SpatialConstants::POSITION_COMPONENT_ID:
 	case SpatialConstants::PERSISTENCE_COMPONENT_ID:
@@ -1099,7 +1514,13 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID:
 	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID:
 	case SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID:
-		HandleRPC(Op);
+		HandleRPC(Op, DecodedRPCs.IsValid() ? MoveTemp(*DecodedRPCs) : RPCEndpointEvents(Op.update));
+		return;
+	case SpatialConstants::CROSS_SERVER_RPC_SENDER_COMPONENT_ID:
+		ProcessCrossServerRPCBatches(Op.entity_id, Schema_GetComponentUpdateFields(Op.update.schema_type));
+		return;
+	case SpatialConstants::CROSS_SERVER_RPC_ACKS_COMPONENT_ID:
+		OnCrossServerRPCAcksChanged(Op.entity_id);
 		return;
 	}
 
@@ -1164,7 +1585,7 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 	}
 }
 
-void USpatialReceiver::HandleRPC(const Worker_ComponentUpdateOp& Op)
+void USpatialReceiver::HandleRPC(const Worker_ComponentUpdateOp& Op, RPCEndpointEvents&& RPCs)
 {
 	Worker_EntityId EntityId = Op.entity_id;
 
@@ -1183,38 +1604,25 @@ void USpatialReceiver::HandleRPC(const Worker_ComponentUpdateOp& Op)
 	}
 
 	// Always process unpacked RPCs since some cannot be packed.
-	ProcessRPCEventField(EntityId, Op, RPCEndpointComponentId, /* bPacked */ false);
-
-	if (GetDefault<USpatialGDKSettings>()->bPackRPCs)
+	for (RPCPayload& Payload : RPCs.RPCs)
 	{
-		// Only process packed RPCs if packing is enabled
-		ProcessRPCEventField(EntityId, Op, RPCEndpointComponentId, /* bPacked */ true);
+		const FUnrealObjectRef ObjectRef(EntityId, Payload.Offset);
+		ProcessRPC(ObjectRef, MoveTemp(Payload));
 	}
-}
-
-void USpatialReceiver::ProcessRPCEventField(Worker_EntityId EntityId, const Worker_ComponentUpdateOp& Op, Worker_ComponentId RPCEndpointComponentId, bool bPacked)
-{
-	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Op.update.schema_type);
-	const Schema_FieldId EventId = bPacked ? SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID : SpatialConstants::UNREAL_RPC_ENDPOINT_EVENT_ID;
-	uint32 EventCount = Schema_GetObjectCount(EventsObject, EventId);
 
-	for (uint32 i = 0; i < EventCount; i++)
+	if (GetDefault<USpatialGDKSettings>()->bPackRPCs)
 	{
-		Schema_Object* EventData = Schema_IndexObject(EventsObject, EventId, i);
-
-		RPCPayload Payload(EventData);
-
-		FUnrealObjectRef ObjectRef(EntityId, Payload.Offset);
-
-		if (bPacked)
+		// Only process packed RPCs if packing is enabled
+		for (RPCEndpointEvents::PackedRPC& PackedRPC : RPCs.PackedRPCs)
 		{
+			FUnrealObjectRef ObjectRef(EntityId, PackedRPC.Payload.Offset);
+
 			// When packing unreliable RPCs into one update, they also always go through the PlayerController.
 			// This means we need to retrieve the actual target Entity ID from the payload.
 			if (Op.update.component_id == SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID ||
 				Op.update.component_id == SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID)
 			{
-				ObjectRef.Entity = Schema_GetEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID);
-
+				ObjectRef.Entity = PackedRPC.TargetEntityId;
 
 				// In a zoned multiworker scenario we might not have gained authority over the current entity in this bundle in time
 				// before processing so don't ApplyRPCs to an entity that we don't have authority over.
@@ -1223,27 +1631,121 @@ void USpatialReceiver::ProcessRPCEventField(Worker_EntityId EntityId, const Work
 					continue;
 				}
 			}
+
+			ProcessRPC(ObjectRef, MoveTemp(PackedRPC.Payload));
+		}
+	}
+}
+
+void USpatialReceiver::ProcessRPC(const FUnrealObjectRef& ObjectRef, RPCPayload&& Payload)
+{
+	FPendingRPCParamsPtr Params = MakeUnique<FPendingRPCParams>(ObjectRef, MoveTemp(Payload));
+	if (UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get())
+	{
+		const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObject);
+		UFunction* Function = ClassInfo.RPCs[Params->Payload.Index];
+		const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
+
+		if (!IncomingRPCs.ObjectHasRPCsQueuedOfType(ObjectRef.Entity, RPCInfo.Type))
+		{
+			// Apply if possible, queue otherwise
+			if (ApplyRPC(*Params))
+			{
+				return;
+			}
 		}
+	}
+
+	QueueIncomingRPC(MoveTemp(Params));
+}
 
-		FPendingRPCParamsPtr Params = MakeUnique<FPendingRPCParams>(ObjectRef, MoveTemp(Payload));
-		if (UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get())
+void USpatialReceiver::ProcessCrossServerRPCBatches(Worker_EntityId SenderWorkerEntityId, Schema_Object* SenderComponentObject)
+{
+	// Our own ring buffer is only read by the other servers, the sender delivers RPCs to entities we're authoritative over itself.
+	if (SenderWorkerEntityId == NetDriver->WorkerEntityId || StaticComponentView->HasAuthority(SenderWorkerEntityId, SpatialConstants::CROSS_SERVER_RPC_SENDER_COMPONENT_ID))
+	{
+		return;
+	}
+
+	CrossServerRPCSenderAck* Ack = LocalCrossServerRPCAcks.SenderAcks.Find(SenderWorkerEntityId);
+	if (Ack == nullptr)
+	{
+		// First time we see this sender (we just started, or its worker entity came back into view).
+		CrossServerRPCSenderAck NewAck;
+		if (StartCrossServerRPCSenderAck(SenderComponentObject, NewAck))
 		{
-			const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObject);
-			UFunction* Function = ClassInfo.RPCs[Payload.Index];
-			const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
+			LocalCrossServerRPCAcks.SenderAcks.Add(SenderWorkerEntityId, MoveTemp(NewAck));
+			bCrossServerRPCAcksDirty = true;
+		}
+		return;
+	}
 
-			if (!IncomingRPCs.ObjectHasRPCsQueuedOfType(ObjectRef.Entity, RPCInfo.Type))
+	if (ReadCrossServerRPCBatches(SenderWorkerEntityId, SenderComponentObject, *Ack, [this](const FUnrealObjectRef& TargetObjectRef, RPCPayload&& Payload)
+	{
+		return ReceiveCrossServerRPC(TargetObjectRef, MoveTemp(Payload));
+	}))
+	{
+		bCrossServerRPCAcksDirty = true;
+	}
+}
+
+bool USpatialReceiver::ReceiveCrossServerRPC(const FUnrealObjectRef& ObjectRef, RPCPayload&& Payload)
+{
+	// Every server reads every batch, only the one that would have received the command executes the RPC. If none is
+	// authoritative right now, the sender sees that nobody executed it and sends it again if it's reliable.
+	if (!StaticComponentView->HasAuthority(ObjectRef.Entity, SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID))
+	{
+		return false;
+	}
+
+	FPendingRPCParamsPtr Params = MakeUnique<FPendingRPCParams>(ObjectRef, MoveTemp(Payload));
+	if (UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get())
+	{
+		const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObject);
+		UFunction* Function = ClassInfo.RPCs[Params->Payload.Index];
+		const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
+
+		if (!IncomingRPCs.ObjectHasRPCsQueuedOfType(ObjectRef.Entity, RPCInfo.Type))
+		{
+			// Apply if possible, queue otherwise
+			if (ApplyRPC(*Params))
 			{
-				// Apply if possible, queue otherwise
-				if (ApplyRPC(*Params))
-				{
-					continue;
-				}
+				return true;
 			}
 		}
+	}
+
+	// Queued RPCs are applied by us once their refs resolve, so they count as executed as well.
+	QueueIncomingRPC(MoveTemp(Params));
+	return true;
+}
+
+void USpatialReceiver::OnCrossServerRPCAcksChanged(Worker_EntityId ReceiverWorkerEntityId)
+{
+	if (CrossServerRPCAcks* Acks = StaticComponentView->GetComponentData<CrossServerRPCAcks>(ReceiverWorkerEntityId))
+	{
+		Sender->OnCrossServerRPCAcksUpdated(ReceiverWorkerEntityId, *Acks);
+	}
+}
+
+void USpatialReceiver::FlushCrossServerRPCAcks()
+{
+	if (!bCrossServerRPCAcksDirty)
+	{
+		return;
+	}
 
-		QueueIncomingRPC(MoveTemp(Params));
+	// Stays dirty until our worker entity is ready to publish acks.
+	if (NetDriver->WorkerEntityId == SpatialConstants::INVALID_ENTITY_ID
+		|| !StaticComponentView->HasAuthority(NetDriver->WorkerEntityId, SpatialConstants::CROSS_SERVER_RPC_ACKS_COMPONENT_ID))
+	{
+		return;
 	}
+
+	Worker_ComponentUpdate Update = LocalCrossServerRPCAcks.CreateCrossServerRPCAcksUpdate();
+	NetDriver->Connection->SendComponentUpdate(NetDriver->WorkerEntityId, &Update);
+
+	bCrossServerRPCAcksDirty = false;
 }
 
 void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
@@ -1258,7 +1760,7 @@ void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 		// 1. The attribute of the worker type
 		// 2. The attribute of the specific worker that sent the request
 		// We want to give authority to the specific worker, so we grab the second element from the attribute set.
-		NetDriver->PlayerSpawner->ReceivePlayerSpawnRequest(Payload, Op.caller_attribute_set.attributes[1], Op.request_id);
+		NetDriver->PlayerSpawner->ReceivePlayerSpawnRequest(Payload, Op.caller_attribute_set.attributes[1], Op.request_id, Op.entity_id);
 		return;
 	}
 	else if (Op.request.component_id == SpatialConstants::RPCS_ON_ENTITY_CREATION_ID && CommandIndex == SpatialConstants::CLEAR_RPCS_ON_ENTITY_CREATION)
@@ -1394,14 +1896,14 @@ void USpatialReceiver::ReceiveCommandResponse(const Worker_CommandResponseOp& Op
 			}
 
 			// Queue retry
-			FTimerHandle RetryTimer;
-			TimerManager->SetTimer(RetryTimer, [WeakSender = TWeakObjectPtr<USpatialSender>(Sender), ReliableRPC]()
+			FTimingWheelHandle RetryTimer;
+			TimingWheel->SetTimer(RetryTimer, [WeakSender = TWeakObjectPtr<USpatialSender>(Sender), ReliableRPC]()
 			{
 				if (USpatialSender* SpatialSender = WeakSender.Get())
 				{
 					SpatialSender->EnqueueRetryRPC(ReliableRPC);
 				}
-			}, WaitTime, false);
+			}, WaitTime);
 		}
 		else
 		{
@@ -1510,7 +2012,7 @@ bool USpatialReceiver::ApplyRPC(const FPendingRPCParams& Params)
 	}
 
 	bool bApplyWithUnresolvedRefs = false;
-	const float TimeDiff = (FDateTime::Now() - Params.QueuedTimestamp).GetTotalSeconds();
+	const float TimeDiff = FPlatformTime::Seconds() - Params.QueuedTimestamp;
 	if (GetDefault<USpatialGDKSettings>()->QueuedIncomingRPCWaitTime < TimeDiff)
 	{
 		UE_LOG(LogSpatialReceiver, Warning, TEXT("Executing RPC %s::%s with unresolved references after %f seconds of queueing"), *TargetObjectWeakPtr->GetName(), *Function->GetName(), TimeDiff);
@@ -1947,23 +2449,6 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 		return;
 	}
 
-	TWeakObjectPtr<USpatialNetConnection>* ConnectionPtr = AuthorityPlayerControllerConnectionMap.Find(Op.entity_id);
-	if (ConnectionPtr == nullptr)
-	{
-		// Heartbeat component update on a PlayerController that this server does not have authority over.
-		// TODO: Disable component interest for Heartbeat components this server doesn't care about - UNR-986
-		return;
-	}
-
-	if (!ConnectionPtr->IsValid())
-	{
-		UE_LOG(LogSpatialReceiver, Warning, TEXT("Received heartbeat component update after NetConnection has been cleaned up. PlayerController entity: %lld"), Op.entity_id);
-		AuthorityPlayerControllerConnectionMap.Remove(Op.entity_id);
-		return;
-	}
-
-	USpatialNetConnection* NetConnection = ConnectionPtr->Get();
-
 	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Op.update.schema_type);
 	uint32 EventCount = Schema_GetObjectCount(EventsObject, SpatialConstants::HEARTBEAT_EVENT_ID);
 	if (EventCount > 0)
@@ -1973,15 +2458,55 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 			UE_LOG(LogSpatialReceiver, Verbose, TEXT("Received multiple heartbeat events in a single component update, entity %lld."), Op.entity_id);
 		}
 
-		NetConnection->OnHeartbeat();
+		if (!HeartbeatTracker.RecordHeartbeat(Op.entity_id, NetDriver->Time))
+		{
+			// Heartbeat component update on a PlayerController that this server does not have authority over.
+			return;
+		}
 	}
 
 	Schema_Object* FieldsObject = Schema_GetComponentUpdateFields(Op.update.schema_type);
 	if (Schema_GetBoolCount(FieldsObject, SpatialConstants::HEARTBEAT_CLIENT_HAS_QUIT_ID) > 0 &&
 		GetBoolFromSchema(FieldsObject, SpatialConstants::HEARTBEAT_CLIENT_HAS_QUIT_ID))
 	{
+		if (!HeartbeatTracker.Contains(Op.entity_id))
+		{
+			return;
+		}
+
+		USpatialNetConnection* NetConnection = HeartbeatTracker.GetConnection(Op.entity_id);
+		HeartbeatTracker.Remove(Op.entity_id);
+
+		if (NetConnection == nullptr)
+		{
+			UE_LOG(LogSpatialReceiver, Warning, TEXT("Received heartbeat component update after NetConnection has been cleaned up. PlayerController entity: %lld"), Op.entity_id);
+			return;
+		}
+
 		// Client has disconnected, let's clean up their connection.
 		NetConnection->CleanUp();
-		AuthorityPlayerControllerConnectionMap.Remove(Op.entity_id);
 	}
-} 
+}
+
+void USpatialReceiver::CheckHeartbeatTimeouts()
+{
+	TArray<USpatialNetConnection*> TimedOutConnections;
+	HeartbeatTracker.RemoveTimedOutConnections(NetDriver->Time, GetDefault<USpatialGDKSettings>()->HeartbeatTimeoutSeconds, TimedOutConnections);
+
+	for (USpatialNetConnection* Connection : TimedOutConnections)
+	{
+		// This client timed out. Disconnect it and trigger OnDisconnected logic.
+		UE_LOG(LogSpatialReceiver, Log, TEXT("Heartbeat timed out for PlayerController entity %lld, cleaning up its connection."), Connection->PlayerControllerEntity);
+		Connection->CleanUp();
+	}
+}
+
+void USpatialReceiver::SetHeartbeatInterest(Worker_EntityId PlayerControllerEntity, bool bInterested)
+{
+	if (GetDefault<USpatialGDKSettings>()->bEnableHeartbeatInterestForNonAuthoritativeServers)
+	{
+		return;
+	}
+
+	NetDriver->Connection->SendComponentInterest(PlayerControllerEntity, { { SpatialConstants::HEARTBEAT_COMPONENT_ID, bInterested } });
+}
@@ -50,12 +50,10 @@ FReliableRPCForRetry::FReliableRPCForRetry(UObject* InTargetObject, UFunction* I
 {
 }
 
-FPendingRPC::FPendingRPC(FPendingRPC&& Other)
-	: Offset(Other.Offset)
-	, Index(Other.Index)
-	, Data(MoveTemp(Other.Data))
-	, Entity(Other.Entity)
+namespace
 {
+// Rough upper bound on the schema encoding overhead of a packed RPC event (field tags, offset, index and entity id).
+const uint32 PACKED_RPC_EVENT_OVERHEAD_BYTES = 24;
 }
 
 void USpatialSender::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager)
@@ -70,6 +68,21 @@ void USpatialSender::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimer
 	TimerManager = InTimerManager;
 }
 
+void USpatialSender::BeginDestroy()
+{
+	// Updates that were still being filled when the connection went away are never handed to the worker, so free them here.
+	for (auto& It : RPCsToPack)
+	{
+		for (FPendingPackedRPCUpdate& PackedUpdate : It.Value)
+		{
+			Schema_DestroyComponentUpdate(PackedUpdate.Update.schema_type);
+		}
+	}
+	RPCsToPack.Empty();
+
+	Super::BeginDestroy();
+}
+
 Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 {
 	AActor* Actor = Channel->Actor;
@@ -489,15 +502,45 @@ void USpatialSender::CreateServerWorkerEntity(int AttemptCounter)
 	ComponentInterest Queries;
 	Queries.Queries.Add(Query);
 
+	WorkerRequirementSet ReadAcl = WorkerIdPermission;
+
+	const bool bUseCrossServerRPCRingBuffer = GetDefault<USpatialGDKSettings>()->bUseRingBufferForCrossServerRPCs;
+	if (bUseCrossServerRPCRingBuffer)
+	{
+		ComponentWriteAcl.Add(SpatialConstants::CROSS_SERVER_RPC_SENDER_COMPONENT_ID, WorkerIdPermission);
+		ComponentWriteAcl.Add(SpatialConstants::CROSS_SERVER_RPC_ACKS_COMPONENT_ID, WorkerIdPermission);
+
+		// Other servers need to read our ring buffer and acks, and we need to read theirs.
+		for (const FName& WorkerType : GetDefault<USpatialGDKSettings>()->ServerWorkerTypes)
+		{
+			ReadAcl.Add({ WorkerType.ToString() });
+		}
+
+		QueryConstraint RingBufferConstraint;
+		RingBufferConstraint.ComponentConstraint = SpatialConstants::CROSS_SERVER_RPC_SENDER_COMPONENT_ID;
+
+		SpatialGDK::Query RingBufferQuery;
+		RingBufferQuery.Constraint = RingBufferConstraint;
+		RingBufferQuery.FullSnapshotResult = true;
+
+		Queries.Queries.Add(RingBufferQuery);
+	}
+
 	Interest Interest;
 	Interest.ComponentInterestMap.Add(SpatialConstants::POSITION_COMPONENT_ID, Queries);
 
 	TArray<Worker_ComponentData> Components;
 	Components.Add(Position().CreatePositionData());
 	Components.Add(Metadata(FString::Format(TEXT("WorkerEntity:{0}"), { Connection->GetWorkerId() })).CreateMetadataData());
-	Components.Add(EntityAcl(WorkerIdPermission, ComponentWriteAcl).CreateEntityAclData());
+	Components.Add(EntityAcl(ReadAcl, ComponentWriteAcl).CreateEntityAclData());
 	Components.Add(Interest.CreateInterestData());
 
+	if (bUseCrossServerRPCRingBuffer)
+	{
+		Components.Add(CrossServerRPCSender::CreateCrossServerRPCSenderData());
+		Components.Add(CrossServerRPCAcks().CreateCrossServerRPCAcksData());
+	}
+
 	Worker_RequestId RequestId = Connection->SendCreateEntityRequest(MoveTemp(Components), nullptr);
 
 	CreateEntityDelegate OnCreateWorkerEntityResponse;
@@ -599,6 +642,12 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 			continue;
 		}
 
+		if (Update.component_id == SpatialConstants::INTEREST_COMPONENT_ID)
+		{
+			// Not built from an Interest we can hash, so make sure the next rebuilt Interest is sent.
+			ClearLastSentInterest(EntityId);
+		}
+
 		Connection->SendComponentUpdate(EntityId, &Update);
 	}
 }
@@ -623,34 +672,149 @@ void USpatialSender::FlushPackedRPCs()
 		return;
 	}
 
-	// TODO: This could be further optimized for the case when there's only 1 RPC to be sent during this frame
-	// by sending it directly to the corresponding entity, without including the EntityId in the payload - UNR-1563.
-	for (const auto& It : RPCsToPack)
+	FPackedRPCStats Stats;
+
+	for (auto& It : RPCsToPack)
 	{
 		Worker_EntityId PlayerControllerEntityId = It.Key;
-		const TArray<FPendingRPC>& PendingRPCArray = It.Value;
+		TArray<FPendingPackedRPCUpdate>& PackedUpdates = It.Value;
 
-		Worker_ComponentUpdate ComponentUpdate = {};
-
-		Worker_ComponentId ComponentId = NetDriver->IsServer() ? SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID : SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID;
-		ComponentUpdate.component_id = ComponentId;
-		ComponentUpdate.schema_type = Schema_CreateComponentUpdate(ComponentId);
-		Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(ComponentUpdate.schema_type);
+		// If there's only 1 RPC to be sent to this player controller during this frame, send it directly
+		// to the corresponding entity, without including the EntityId in the payload - UNR-1563.
+		if (PackedUpdates.Num() == 1 && PackedUpdates[0].NumRPCs == 1
+			&& StaticComponentView->HasAuthority(PackedUpdates[0].FirstRPCEntity, PackedUpdates[0].FirstRPCComponentId))
+		{
+			SendSinglePackedRPCDirectly(PackedUpdates[0]);
+			Stats.DirectRPCs++;
+			continue;
+		}
 
-		for (const FPendingRPC& RPC : PendingRPCArray)
+		for (FPendingPackedRPCUpdate& PackedUpdate : PackedUpdates)
 		{
-			Schema_Object* EventData = Schema_AddObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
+			Stats.PackedUpdates++;
+			Stats.PackedRPCs += PackedUpdate.NumRPCs;
+			Stats.PackedBytes += PackedUpdate.EstimatedSize;
 
-			Schema_AddUint32(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_OFFSET_ID, RPC.Offset);
-			Schema_AddUint32(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_INDEX_ID, RPC.Index);
-			SpatialGDK::AddBytesToSchema(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID, RPC.Data.GetData(), RPC.Data.Num());
-			Schema_AddEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID, RPC.Entity);
+			Connection->SendComponentUpdate(PlayerControllerEntityId, &PackedUpdate.Update);
 		}
-
-		Connection->SendComponentUpdate(PlayerControllerEntityId, &ComponentUpdate);
 	}
 
 	RPCsToPack.Empty();
+
+	NetDriver->SpatialMetrics->TrackPackedRPCFlush(Stats);
+}
+
+FPendingPackedRPCUpdate& USpatialSender::GetPackedRPCUpdateWithSpace(Worker_EntityId PlayerControllerEntityId, uint32 RequiredSize)
+{
+	TArray<FPendingPackedRPCUpdate>& PackedUpdates = RPCsToPack.FindOrAdd(PlayerControllerEntityId);
+
+	// Keep filling the last update unless the RPC would push it over the limit. An RPC that is larger
+	// than the limit on its own still gets an update to itself.
+	if (PackedUpdates.Num() > 0)
+	{
+		FPendingPackedRPCUpdate& LastUpdate = PackedUpdates.Last();
+		if (LastUpdate.EstimatedSize + RequiredSize <= GetDefault<USpatialGDKSettings>()->MaxRPCPackedUpdateSize)
+		{
+			return LastUpdate;
+		}
+	}
+
+	Worker_ComponentId ComponentId = NetDriver->IsServer() ? SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID : SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID;
+
+	FPendingPackedRPCUpdate& PackedUpdate = PackedUpdates.AddDefaulted_GetRef();
+	PackedUpdate.Update = {};
+	PackedUpdate.Update.component_id = ComponentId;
+	PackedUpdate.Update.schema_type = Schema_CreateComponentUpdate(ComponentId);
+	PackedUpdate.NumRPCs = 0;
+	PackedUpdate.EstimatedSize = 0;
+	PackedUpdate.FirstRPCEntity = SpatialConstants::INVALID_ENTITY_ID;
+	PackedUpdate.FirstRPCComponentId = SpatialConstants::INVALID_COMPONENT_ID;
+
+	return PackedUpdate;
+}
+
+void USpatialSender::SendSinglePackedRPCDirectly(FPendingPackedRPCUpdate& PackedUpdate)
+{
+	Schema_Object* PackedEventsObject = Schema_GetComponentUpdateEvents(PackedUpdate.Update.schema_type);
+	Schema_Object* PackedEventData = Schema_GetObject(PackedEventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
+
+	Worker_ComponentUpdate ComponentUpdate = {};
+	ComponentUpdate.component_id = PackedUpdate.FirstRPCComponentId;
+	ComponentUpdate.schema_type = Schema_CreateComponentUpdate(PackedUpdate.FirstRPCComponentId);
+	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(ComponentUpdate.schema_type);
+	Schema_Object* EventData = Schema_AddObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_EVENT_ID);
+
+	RPCPayload::WriteToSchemaObject(EventData,
+		Schema_GetUint32(PackedEventData, SpatialConstants::UNREAL_RPC_PAYLOAD_OFFSET_ID),
+		Schema_GetUint32(PackedEventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_INDEX_ID),
+		Schema_GetBytes(PackedEventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID),
+		Schema_GetBytesLength(PackedEventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID));
+
+	Schema_DestroyComponentUpdate(PackedUpdate.Update.schema_type);
+
+	Connection->SendComponentUpdate(PackedUpdate.FirstRPCEntity, &ComponentUpdate);
+}
+
+bool USpatialSender::CanSendCrossServerRPCBatches() const
+{
+	return NetDriver->WorkerEntityId != SpatialConstants::INVALID_ENTITY_ID
+		&& StaticComponentView->HasAuthority(NetDriver->WorkerEntityId, SpatialConstants::CROSS_SERVER_RPC_SENDER_COMPONENT_ID);
+}
+
+void USpatialSender::FlushCrossServerRPCs()
+{
+	// RPCs left queued because the ring buffer was full, or before our worker entity was ready, aren't retried by anything else.
+	if (OutgoingRPCs.GetNumQueuedRPCs() > 0 && CanSendCrossServerRPCBatches())
+	{
+		SendOutgoingRPCs();
+	}
+
+	Worker_ComponentUpdate BatchUpdate;
+	if (!CrossServerRPCs.FlushBatch(BatchUpdate))
+	{
+		return;
+	}
+
+	Connection->SendComponentUpdate(NetDriver->WorkerEntityId, &BatchUpdate);
+
+	// We don't see our own ring buffer updates, so deliver the RPCs to entities we're authoritative over ourselves.
+	CrossServerRPCs.ExecuteLastFlushedBatchLocally([this](const FUnrealObjectRef& TargetObjectRef, const RPCPayload& Payload)
+	{
+		return Receiver->ReceiveCrossServerRPC(TargetObjectRef, RPCPayload(Payload));
+	});
+
+	// With no other servers in view, the batch is resolved as soon as we've read it ourselves.
+	ResolveCrossServerRPCBatches();
+}
+
+void USpatialSender::ResolveCrossServerRPCBatches()
+{
+	const int32 NumDropped = CrossServerRPCs.ResolveAcknowledgedBatches();
+	if (NumDropped > 0)
+	{
+		UE_LOG(LogSpatialSender, Error, TEXT("Dropped %d reliable cross-server RPCs no server executed after %u resends."), NumDropped, SpatialConstants::CROSS_SERVER_RPC_MAX_RESENDS);
+	}
+}
+
+void USpatialSender::OnCrossServerRPCAcksUpdated(Worker_EntityId ReceiverWorkerEntityId, const CrossServerRPCAcks& Acks)
+{
+	if (ReceiverWorkerEntityId == NetDriver->WorkerEntityId)
+	{
+		return;
+	}
+
+	// A server that hasn't seen our ring buffer yet holds up every batch until it starts reading after the last one sent.
+	const CrossServerRPCSenderAck* Ack = Acks.SenderAcks.Find(NetDriver->WorkerEntityId);
+	CrossServerRPCs.SetReceiverAck(ReceiverWorkerEntityId, Ack != nullptr ? *Ack : CrossServerRPCSenderAck());
+
+	ResolveCrossServerRPCBatches();
+}
+
+void USpatialSender::OnCrossServerRPCAcksRemoved(Worker_EntityId ReceiverWorkerEntityId)
+{
+	CrossServerRPCs.RemoveReceiver(ReceiverWorkerEntityId);
+
+	ResolveCrossServerRPCBatches();
 }
 
 void FillComponentInterests(const FClassInfo& Info, bool bNetOwned, TArray<Worker_InterestOverride>& ComponentInterest)
@@ -746,6 +910,8 @@ void USpatialSender::SendPositionUpdate(Worker_EntityId EntityId, const FVector&
 
 bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 {
+	const uint32 SendStartCycles = FPlatformTime::Cycles();
+
 	TWeakObjectPtr<UObject> TargetObjectWeakPtr = PackageMap->GetObjectFromUnrealObjectRef(Params.ObjectRef);
 	if (!TargetObjectWeakPtr.IsValid())
 	{
@@ -779,9 +945,7 @@ bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 			check(NetDriver->IsServer());
 
 			OutgoingOnCreateEntityRPCs.FindOrAdd(TargetObject).RPCs.Add(Params.Payload);
-#if !UE_BUILD_SHIPPING
-			NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params.Payload.PayloadData.Num());
-#endif // !UE_BUILD_SHIPPING
+			NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params, SendStartCycles);
 			return true;
 		}
 		else
@@ -796,6 +960,32 @@ bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 	{
 	case SCHEMA_CrossServerRPC:
 	{
+		if (GetDefault<USpatialGDKSettings>()->bUseRingBufferForCrossServerRPCs)
+		{
+			FUnrealObjectRef TargetObjectRef = PackageMap->GetUnrealObjectRefFromObject(TargetObject);
+			if (TargetObjectRef == FUnrealObjectRef::UNRESOLVED_OBJECT_REF)
+			{
+				return false;
+			}
+
+			// Reliable RPCs are acknowledged by the server that executes them and sent again in a later batch if none did,
+			// e.g. because their target was mid authority handoff, so they don't need commands either.
+			if (!CanSendCrossServerRPCBatches())
+			{
+				return false;
+			}
+
+			if (!CrossServerRPCs.AddRPC(TargetObjectRef, Params.Payload, Function->HasAnyFunctionFlags(FUNC_NetReliable)))
+			{
+				// The ring buffer is full until the other servers acknowledge older batches, keep the RPC queued until then.
+				UE_LOG(LogSpatialSender, Verbose, TEXT("Cross-server RPC ring buffer full, queuing RPC %s on %s."), *Function->GetName(), *TargetObject->GetName());
+				return false;
+			}
+
+			NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params, SendStartCycles);
+			return true;
+		}
+
 		Worker_ComponentId ComponentId = SchemaComponentTypeToWorkerComponentId(RPCInfo.Type);
 
 		const UObject* UnresolvedObject = nullptr;
@@ -809,15 +999,14 @@ bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 		check(EntityId != SpatialConstants::INVALID_ENTITY_ID);
 		Worker_RequestId RequestId = Connection->SendCommandRequest(EntityId, &CommandRequest, SpatialConstants::UNREAL_RPC_ENDPOINT_COMMAND_ID);
 
-#if !UE_BUILD_SHIPPING
-		NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params.Payload.PayloadData.Num());
-#endif // !UE_BUILD_SHIPPING
+		NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params, SendStartCycles);
 
 		if (Function->HasAnyFunctionFlags(FUNC_NetReliable))
 		{
 			UE_LOG(LogSpatialSender, Verbose, TEXT("Sending reliable command request (entity: %lld, component: %d, function: %s, attempt: 1)"),
 				EntityId, CommandRequest.component_id, *Function->GetName());
-			Receiver->AddPendingReliableRPC(RequestId, MakeShared<FReliableRPCForRetry>(TargetObject, Function, ComponentId, RPCInfo.Index, Params.Payload.PayloadData, 0));
+			TSharedRef<FReliableRPCForRetry> ReliableRPC = MakeShared<FReliableRPCForRetry>(TargetObject, Function, ComponentId, RPCInfo.Index, Params.Payload.PayloadData, 0);
+			Receiver->AddPendingReliableRPC(RequestId, ReliableRPC);
 		}
 		else
 		{
@@ -885,9 +1074,7 @@ bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 			const UObject* UnresolvedObject = nullptr;
 			if (AddPendingRPC(TargetObject, Params, ComponentId, RPCInfo.Index, UnresolvedObject))
 			{
-#if !UE_BUILD_SHIPPING
-				NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params.Payload.PayloadData.Num());
-#endif // !UE_BUILD_SHIPPING
+				NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params, SendStartCycles);
 				return true;
 			}
 			else
@@ -911,9 +1098,7 @@ bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 			}
 
 			Connection->SendComponentUpdate(EntityId, &ComponentUpdate);
-#if !UE_BUILD_SHIPPING
-			NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params.Payload.PayloadData.Num());
-#endif // !UE_BUILD_SHIPPING
+			NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params, SendStartCycles);
 			return true;
 		}
 	}
@@ -1257,15 +1442,24 @@ bool USpatialSender::AddPendingRPC(UObject* TargetObject, const FPendingRPCParam
 		return false;
 	}
 
-	TSet<TWeakObjectPtr<const UObject>> UnresolvedObjects;
+	const TArray<uint8>& PayloadData = Parameters.Payload.PayloadData;
+	const uint32 RequiredSize = PayloadData.Num() + PACKED_RPC_EVENT_OVERHEAD_BYTES;
+
+	FPendingPackedRPCUpdate& PackedUpdate = GetPackedRPCUpdateWithSpace(ControllerObjectRef.Entity, RequiredSize);
+	if (PackedUpdate.NumRPCs == 0)
+	{
+		PackedUpdate.FirstRPCEntity = TargetObjectRef.Entity;
+		PackedUpdate.FirstRPCComponentId = ComponentId;
+	}
+
+	// Write the payload straight into the packed update instead of holding on to a copy until the flush.
+	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(PackedUpdate.Update.schema_type);
+	Schema_Object* EventData = Schema_AddObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
+	RPCPayload::WriteToSchemaObject(EventData, TargetObjectRef.Offset, RPCIndex, PayloadData.GetData(), PayloadData.Num());
+	Schema_AddEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID, TargetObjectRef.Entity);
 
-	FPendingRPC RPC;
-	RPC.Offset = TargetObjectRef.Offset;
-	RPC.Index = RPCIndex;
-	RPC.Data.SetNumUninitialized(Parameters.Payload.PayloadData.Num());
-	FMemory::Memcpy(RPC.Data.GetData(), Parameters.Payload.PayloadData.GetData(), Parameters.Payload.PayloadData.Num());
-	RPC.Entity = TargetObjectRef.Entity;
-	RPCsToPack.FindOrAdd(ControllerObjectRef.Entity).Emplace(MoveTemp(RPC));
+	PackedUpdate.NumRPCs++;
+	PackedUpdate.EstimatedSize += RequiredSize;
 	return true;
 }
 
@@ -1393,12 +1587,44 @@ bool USpatialSender::UpdateEntityACLs(Worker_EntityId EntityId, const FString& O
 void USpatialSender::UpdateInterestComponent(AActor* Actor)
 {
 	InterestFactory InterestUpdateFactory(Actor, ClassInfoManager->GetOrCreateClassInfoByObject(Actor), NetDriver);
-	Worker_ComponentUpdate Update = InterestUpdateFactory.CreateInterestUpdate();
+	Interest ActorInterest = InterestUpdateFactory.CreateInterest();
 
 	Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(Actor);
+	if (!RecordSentInterest(EntityId, ActorInterest))
+	{
+		return;
+	}
+
+	Worker_ComponentUpdate Update = ActorInterest.CreateInterestUpdate();
 	Connection->SendComponentUpdate(EntityId, &Update);
 }
 
+bool USpatialSender::RecordSentInterest(Worker_EntityId EntityId, const Interest& NewInterest)
+{
+	// The Interest component is a single map field, which can only be sent in full, so the best we can do is skip identical updates.
+	// Interests rebuilt after an actual change almost always hash differently, so the full comparison rarely runs for those.
+	const uint32 InterestHash = NewInterest.GetInterestHash();
+	if (FSentInterest* LastSent = LastSentInterests.Find(EntityId))
+	{
+		if (LastSent->Hash == InterestHash && LastSent->SentInterest == NewInterest)
+		{
+			return false;
+		}
+
+		LastSent->Hash = InterestHash;
+		LastSent->SentInterest = NewInterest;
+		return true;
+	}
+
+	LastSentInterests.Add(EntityId, FSentInterest{ InterestHash, NewInterest });
+	return true;
+}
+
+void USpatialSender::ClearLastSentInterest(Worker_EntityId EntityId)
+{
+	LastSentInterests.Remove(EntityId);
+}
+
 void USpatialSender::ProcessRPC(FPendingRPCParamsPtr Params)
 {
 	TWeakObjectPtr<UObject> TargetObject = PackageMap->GetObjectFromUnrealObjectRef(Params->ObjectRef);
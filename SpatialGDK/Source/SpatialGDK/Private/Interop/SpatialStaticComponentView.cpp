@@ -4,6 +4,7 @@
 
 #include "Schema/ClientRPCEndpoint.h"
 #include "Schema/Component.h"
+#include "Schema/CrossServerRPCRingBuffer.h"
 #include "Schema/Heartbeat.h"
 #include "Schema/Interest.h"
 #include "Schema/RPCPayload.h"
@@ -41,51 +42,64 @@ bool USpatialStaticComponentView::HasComponent(Worker_EntityId EntityId, Worker_
 }
 
 void USpatialStaticComponentView::OnAddComponent(const Worker_AddComponentOp& Op)
+{
+	OnAddComponent(Op, CreateComponentStorage(Op.data));
+}
+
+void USpatialStaticComponentView::OnAddComponent(const Worker_AddComponentOp& Op, TUniquePtr<SpatialGDK::ComponentStorageBase> DecodedData)
+{
+	EntityComponentMap.FindOrAdd(Op.entity_id).FindOrAdd(Op.data.component_id) = MoveTemp(DecodedData);
+}
+
+TUniquePtr<SpatialGDK::ComponentStorageBase> USpatialStaticComponentView::CreateComponentStorage(const Worker_ComponentData& ComponentData)
 {
 	TUniquePtr<SpatialGDK::ComponentStorageBase> Data;
-	switch (Op.data.component_id)
+	switch (ComponentData.component_id)
 	{
 	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::EntityAcl>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::EntityAcl>>(ComponentData);
 		break;
 	case SpatialConstants::METADATA_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Metadata>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Metadata>>(ComponentData);
 		break;
 	case SpatialConstants::POSITION_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Position>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Position>>(ComponentData);
 		break;
 	case SpatialConstants::PERSISTENCE_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Persistence>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Persistence>>(ComponentData);
 		break;
 	case SpatialConstants::SPAWN_DATA_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::SpawnData>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::SpawnData>>(ComponentData);
 		break;
 	case SpatialConstants::SINGLETON_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Singleton>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Singleton>>(ComponentData);
 		break;
 	case SpatialConstants::UNREAL_METADATA_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::UnrealMetadata>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::UnrealMetadata>>(ComponentData);
 		break;
 	case SpatialConstants::INTEREST_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Interest>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Interest>>(ComponentData);
 		break;
 	case SpatialConstants::HEARTBEAT_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Heartbeat>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Heartbeat>>(ComponentData);
 		break;
 	case SpatialConstants::RPCS_ON_ENTITY_CREATION_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::RPCsOnEntityCreation>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::RPCsOnEntityCreation>>(ComponentData);
 		break;
 	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::ClientRPCEndpoint>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::ClientRPCEndpoint>>(ComponentData);
 		break;
 	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::ServerRPCEndpoint>>(Op.data);
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::ServerRPCEndpoint>>(ComponentData);
+		break;
+	case SpatialConstants::CROSS_SERVER_RPC_ACKS_COMPONENT_ID:
+		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::CrossServerRPCAcks>>(ComponentData);
 		break;
 	default:
 		// Component is not hand written, but we still want to know the existence of it on this entity.
 		Data = nullptr;
 	}
-	EntityComponentMap.FindOrAdd(Op.entity_id).FindOrAdd(Op.data.component_id) = std::move(Data);
+	return Data;
 }
 
 void USpatialStaticComponentView::OnRemoveComponent(const Worker_RemoveComponentOp& Op)
@@ -109,28 +123,43 @@ void USpatialStaticComponentView::OnRemoveEntity(Worker_EntityId EntityId)
 
 void USpatialStaticComponentView::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 {
-	SpatialGDK::Component* Component = nullptr;
+	OnComponentUpdate(Op, CreateComponentUpdateStorage(Op.update));
+}
 
-	switch (Op.update.component_id)
+void USpatialStaticComponentView::OnComponentUpdate(const Worker_ComponentUpdateOp& Op, TUniquePtr<SpatialGDK::ComponentUpdateStorageBase> DecodedUpdate)
+{
+	if (!DecodedUpdate.IsValid())
+	{
+		return;
+	}
+
+	if (auto* ComponentStorageMap = EntityComponentMap.Find(Op.entity_id))
+	{
+		TUniquePtr<SpatialGDK::ComponentStorageBase>* Component = ComponentStorageMap->Find(Op.update.component_id);
+		if (Component != nullptr && Component->IsValid())
+		{
+			DecodedUpdate->ApplyTo(**Component);
+		}
+	}
+}
+
+TUniquePtr<SpatialGDK::ComponentUpdateStorageBase> USpatialStaticComponentView::CreateComponentUpdateStorage(const Worker_ComponentUpdate& ComponentUpdate)
+{
+	switch (ComponentUpdate.component_id)
 	{
 	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::EntityAcl>(Op.entity_id);
-		break;
+		return MakeUnique<SpatialGDK::ComponentUpdateStorage<SpatialGDK::EntityAcl>>(ComponentUpdate);
 	case SpatialConstants::POSITION_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::Position>(Op.entity_id);
-		break;
+		return MakeUnique<SpatialGDK::ComponentUpdateStorage<SpatialGDK::Position>>(ComponentUpdate);
 	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::ClientRPCEndpoint>(Op.entity_id);
-		break;
+		return MakeUnique<SpatialGDK::ComponentUpdateStorage<SpatialGDK::ClientRPCEndpoint>>(ComponentUpdate);
 	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::ServerRPCEndpoint>(Op.entity_id);
-		break;
+		return MakeUnique<SpatialGDK::ComponentUpdateStorage<SpatialGDK::ServerRPCEndpoint>>(ComponentUpdate);
+	case SpatialConstants::CROSS_SERVER_RPC_ACKS_COMPONENT_ID:
+		return MakeUnique<SpatialGDK::ComponentUpdateStorage<SpatialGDK::CrossServerRPCAcks>>(ComponentUpdate);
 	default:
-		return;
-	}
-
-	if (Component) {
-		Component->ApplyComponentUpdate(Op.update);
+		// The view only keeps the other components' data as it was added, if at all.
+		return nullptr;
 	}
 }
 
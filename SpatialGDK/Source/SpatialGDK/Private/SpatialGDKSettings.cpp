@@ -17,9 +17,15 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, EntityPoolRefreshCount(2000)
 	, HeartbeatIntervalSeconds(2.0f)
 	, HeartbeatTimeoutSeconds(10.0f)
+	, bEnableHeartbeatInterestForNonAuthoritativeServers(true)
 	, ActorReplicationRateLimit(0)
 	, EntityCreationRateLimit(0)
 	, OpsUpdateRate(1000.0f)
+	, OutgoingBulkMessagesPerOpsUpdate(100)
+	, bAsyncLoadNewActorClasses(false)
+	, ClientEntitySpawnBudgetMs(0.0f)
+	, PlayerSpawnsPerTick(0)
+	, PlayerSpawnerShardCount(1)
 	, bEnableHandover(true)
 	, MaxNetCullDistanceSquared(900000000.0f) // Set to twice the default Actor NetCullDistanceSquared (300m)
 	, QueuedIncomingRPCWaitTime(1.0f)
@@ -30,11 +36,22 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, bEnableMetricsDisplay(false)
 	, MetricsReportRate(2.0f)
 	, bUseFrameTimeAsLoad(false)
+	, bUseBusyTimeAsLoad(false)
+	, LoadEstimateReplicationWeight(1.0f)
+	, LoadEstimateReceiveWeight(1.0f)
+	, LoadEstimateGameplayWeight(1.0f)
+	, LoadEstimateSmoothingFactor(1.0f)
+	, bEnableRPCMetrics(false)
+	, bEnableComponentUpdateSizeMetrics(false)
+	, LogForwardingInterval(0.1f)
+	, MaxForwardedLogMessagesPerSecond(100.0f)
 	, bCheckRPCOrder(false)
 	, bBatchSpatialPositionUpdates(true)
 	, MaxDynamicallyAttachedSubobjectsPerClass(3)
 	, bEnableServerQBI(bUsingQBI)
 	, bPackRPCs(true)
+	, MaxRPCPackedUpdateSize(16 * 1024)
+	, bUseRingBufferForCrossServerRPCs(false)
 	, bUseDevelopmentAuthenticationFlow(false)
 	, DefaultWorkerType(FWorkerType(SpatialConstants::DefaultServerWorkerType))
 	, bEnableOffloading(false)
@@ -0,0 +1,137 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/SpatialClassInfoManager.h"
+
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectIterator.h"
+
+#include "SpatialConstants.h"
+#include "Utils/SchemaDatabase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+
+const int32 BENCHMARK_NUM_CLASSES = 5000;
+// Classes directly below AActor, every other class has one of the earlier classes as its parent.
+const int32 BENCHMARK_NUM_ROOT_CLASSES = 50;
+const Worker_ComponentId BENCHMARK_FIRST_COMPONENT_ID = 100000;
+// Each interest built looks up a class hierarchy per entry in ClientInterestDistancesSquared.
+const int32 BENCHMARK_LOOKUPS_PER_INTEREST = 10;
+const int32 BENCHMARK_NUM_INDEXED_INTERESTS = 1000;
+// The full class iteration is orders of magnitude slower, so it's timed over fewer interests.
+const int32 BENCHMARK_NUM_ITERATED_INTERESTS = 10;
+
+// What GetComponentIdsForClassHierarchy did before the index: walk every loaded class on each call.
+TArray<Worker_ComponentId> GetComponentIdsByIteratingClasses(const USpatialClassInfoManager& ClassInfoManager, const UClass& BaseClass)
+{
+	TArray<Worker_ComponentId> ComponentIds;
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if (It->IsChildOf(&BaseClass))
+		{
+			const Worker_ComponentId ComponentId = ClassInfoManager.GetComponentIdForClass(**It);
+			if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
+			{
+				ComponentIds.Add(ComponentId);
+			}
+		}
+	}
+	ComponentIds.Sort();
+	return ComponentIds;
+}
+
+} // anonymous namespace
+
+// 5000 replicated Actor classes in the schema database, all loaded, as in a large project. Times the class hierarchy lookups
+// InterestFactory makes while building a player's Interest: through the index, cold (including building it) and warm,
+// and by iterating every loaded class as before the index existed.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClassHierarchyIndex5kClassesBenchmark, "SpatialGDK.Interop.ClassInfoManager.ClassHierarchy5kClassesBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FClassHierarchyIndex5kClassesBenchmark::RunTest(const FString& Parameters)
+{
+	USpatialClassInfoManager* ClassInfoManager = NewObject<USpatialClassInfoManager>();
+	ClassInfoManager->SchemaDatabase = NewObject<USchemaDatabase>();
+
+	TArray<UClass*> Classes;
+	Classes.Reserve(BENCHMARK_NUM_CLASSES);
+	for (int32 i = 0; i < BENCHMARK_NUM_CLASSES; i++)
+	{
+		UClass* ParentClass = i < BENCHMARK_NUM_ROOT_CLASSES ? AActor::StaticClass() : Classes[(i - BENCHMARK_NUM_ROOT_CLASSES) / 4];
+
+		const FName ClassName = MakeUniqueObjectName(GetTransientPackage(), UClass::StaticClass(), *FString::Printf(TEXT("SpatialBenchmarkActorClass_%d"), i));
+		UClass* Class = NewObject<UClass>(GetTransientPackage(), ClassName, RF_Public | RF_Transient);
+		Class->SetSuperStruct(ParentClass);
+		Classes.Add(Class);
+
+		FActorSchemaData SchemaData;
+		SchemaData.SchemaComponents[SCHEMA_Data] = BENCHMARK_FIRST_COMPONENT_ID + i;
+		ClassInfoManager->SchemaDatabase->ActorClassPathToSchema.Add(Class->GetPathName(), SchemaData);
+	}
+
+	// The classes a game's interest distances are typically set for sit near the top of the hierarchy.
+	TArray<UClass*> LookedUpClasses;
+	for (int32 i = 0; i < BENCHMARK_LOOKUPS_PER_INTEREST; i++)
+	{
+		LookedUpClasses.Add(Classes[i * 7 % BENCHMARK_NUM_ROOT_CLASSES]);
+	}
+
+	int32 NumIndexedComponentIds = 0;
+	const double ColdStartTime = FPlatformTime::Seconds();
+	for (UClass* Class : LookedUpClasses)
+	{
+		NumIndexedComponentIds += ClassInfoManager->GetComponentIdsForClassHierarchy(*Class).Num();
+	}
+	const double ColdSeconds = FPlatformTime::Seconds() - ColdStartTime;
+
+	const double WarmStartTime = FPlatformTime::Seconds();
+	for (int32 Interest = 0; Interest < BENCHMARK_NUM_INDEXED_INTERESTS; Interest++)
+	{
+		for (UClass* Class : LookedUpClasses)
+		{
+			NumIndexedComponentIds += ClassInfoManager->GetComponentIdsForClassHierarchy(*Class).Num();
+		}
+	}
+	const double WarmSeconds = FPlatformTime::Seconds() - WarmStartTime;
+
+	int32 NumIteratedComponentIds = 0;
+	const double IteratedStartTime = FPlatformTime::Seconds();
+	for (int32 Interest = 0; Interest < BENCHMARK_NUM_ITERATED_INTERESTS; Interest++)
+	{
+		for (UClass* Class : LookedUpClasses)
+		{
+			NumIteratedComponentIds += GetComponentIdsByIteratingClasses(*ClassInfoManager, *Class).Num();
+		}
+	}
+	const double IteratedSeconds = FPlatformTime::Seconds() - IteratedStartTime;
+
+	for (UClass* Class : LookedUpClasses)
+	{
+		TestTrue(FString::Printf(TEXT("Index matches iterating every class for %s"), *Class->GetName()),
+			ClassInfoManager->GetComponentIdsForClassHierarchy(*Class) == GetComponentIdsByIteratingClasses(*ClassInfoManager, *Class));
+	}
+	TestEqual(TEXT("AActor's entry holds every class"), ClassInfoManager->GetComponentIdsForClassHierarchy(*AActor::StaticClass()).Num(), BENCHMARK_NUM_CLASSES);
+	TestEqual(TEXT("Index and iteration find as many component IDs per lookup"),
+		NumIndexedComponentIds / (BENCHMARK_NUM_INDEXED_INTERESTS + 1), NumIteratedComponentIds / BENCHMARK_NUM_ITERATED_INTERESTS);
+
+	AddInfo(FString::Printf(TEXT("%d classes, %d hierarchy lookups per Interest: first Interest with index build %.3fms, indexed %.2fus per Interest, iterating all classes %.3fms per Interest"),
+		BENCHMARK_NUM_CLASSES, BENCHMARK_LOOKUPS_PER_INTEREST,
+		ColdSeconds * 1000.0,
+		WarmSeconds * 1e6 / BENCHMARK_NUM_INDEXED_INTERESTS,
+		IteratedSeconds * 1000.0 / BENCHMARK_NUM_ITERATED_INTERESTS));
+
+	// Leave the transient classes to be collected, and the index to be rebuilt without them.
+	for (UClass* Class : Classes)
+	{
+		Class->ClearFlags(RF_Public);
+		Class->MarkPendingKill();
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,153 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "EngineClasses/SpatialActorChannel.h"
+
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#include "EngineClasses/SpatialNetConnection.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/SpatialConditionMapFilter.h"
+#include "Interop/SpatialReceiver.h"
+#include "Interop/SpatialSender.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "Schema/StandardLibrary.h"
+#include "SpatialConstants.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+
+const int32 BENCHMARK_NUM_UPDATES = 100000;
+// The entity's ACL changes, the way it does when its owner changes, every this many received updates.
+const int32 BENCHMARK_ACL_CHANGE_INTERVAL = 100;
+// Write ACL entries besides the RPC endpoints, one per generated component of a typical Actor.
+const int32 BENCHMARK_NUM_ACL_COMPONENTS = 16;
+const Worker_EntityId BENCHMARK_ENTITY_ID = 1;
+
+SpatialGDK::EntityAcl MakeEntityAcl(const FString& OwnerWorkerId)
+{
+	WorkerRequirementSet ReadAcl = { { TEXT("UnrealWorker") }, { TEXT("UnrealClient") } };
+	WriteAclMap ComponentWriteAcl;
+	for (int32 i = 0; i < BENCHMARK_NUM_ACL_COMPONENTS; i++)
+	{
+		ComponentWriteAcl.Add(10000 + i, { { TEXT("UnrealWorker") } });
+	}
+	ComponentWriteAcl.Add(SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID, { { TEXT("UnrealWorker") } });
+	ComponentWriteAcl.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, { { FString::Printf(TEXT("workerId:%s"), *OwnerWorkerId) } });
+	return SpatialGDK::EntityAcl(ReadAcl, ComponentWriteAcl);
+}
+
+} // anonymous namespace
+
+// A client receiving 100k component updates for a simulated proxy owned by another client, asking the real
+// USpatialActorChannel::GetConditionMapFilter for the conditions to apply each one with. Every 100 updates the
+// entity's ACL changes hands, applied through the static component view and USpatialReceiver::OnComponentUpdate,
+// which invalidates the channel's filter so the next call rebuilds it. The worker connection has no attributes,
+// so the ACL walk never finds a match and always runs to the end. Compared with invalidating before every call,
+// which is the rebuild per update ComponentReader did before the filter was cached.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FConditionMapFilterReceiveBenchmark, "SpatialGDK.Interop.ConditionMapFilter.ReceiveBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FConditionMapFilterReceiveBenchmark::RunTest(const FString& Parameters)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	NetDriver->Connection = NewObject<USpatialWorkerConnection>();
+	NetDriver->StaticComponentView = NewObject<USpatialStaticComponentView>();
+	NetDriver->Sender = NewObject<USpatialSender>();
+	NetDriver->Receiver = NewObject<USpatialReceiver>();
+	NetDriver->Sender->Init(NetDriver, nullptr);
+	NetDriver->Receiver->Init(NetDriver, nullptr);
+
+	USpatialStaticComponentView* StaticComponentView = NetDriver->StaticComponentView;
+	USpatialReceiver* Receiver = NetDriver->Receiver;
+
+	USpatialNetConnection* NetConnection = NewObject<USpatialNetConnection>();
+	NetConnection->Driver = NetDriver;
+
+	USpatialActorChannel* Channel = NewObject<USpatialActorChannel>();
+#if ENGINE_MINOR_VERSION <= 20
+	Channel->Init(NetConnection, 1, /* bOpenedLocally */ false);
+#else
+	Channel->Init(NetConnection, 1, EChannelCreateFlags::None);
+#endif
+	AActor* Actor = NewObject<AActor>(GetTransientPackage());
+	Actor->Role = ROLE_SimulatedProxy;
+	Channel->Actor = Actor;
+	Channel->SetEntityId(BENCHMARK_ENTITY_ID);
+	NetDriver->AddActorChannel(BENCHMARK_ENTITY_ID, Channel);
+
+	Worker_AddComponentOp AddAclOp = {};
+	AddAclOp.entity_id = BENCHMARK_ENTITY_ID;
+	AddAclOp.data = MakeEntityAcl(TEXT("UnrealClient-Owner0")).CreateEntityAclData();
+	StaticComponentView->OnAddComponent(AddAclOp);
+	Schema_DestroyComponentData(AddAclOp.data.schema_type);
+
+	int32 NumAclChanges = 0;
+	auto ChangeOwner = [StaticComponentView, Receiver, &NumAclChanges]()
+	{
+		NumAclChanges++;
+
+		Worker_ComponentUpdateOp UpdateOp = {};
+		UpdateOp.entity_id = BENCHMARK_ENTITY_ID;
+		UpdateOp.update = MakeEntityAcl(FString::Printf(TEXT("UnrealClient-Owner%d"), NumAclChanges % 2)).CreateEntityAclUpdate();
+		StaticComponentView->OnComponentUpdate(UpdateOp);
+		Receiver->OnComponentUpdate(UpdateOp);
+		Schema_DestroyComponentUpdate(UpdateOp.update.schema_type);
+	};
+
+	// Only the GetConditionMapFilter calls are timed, not the ACL changes between them.
+	auto RunUpdates = [Channel, &ChangeOwner](bool bInvalidateEveryUpdate, int32& OutOwnerOnlyRelevant)
+	{
+		double Seconds = 0.0;
+		OutOwnerOnlyRelevant = 0;
+		for (int32 Start = 0; Start < BENCHMARK_NUM_UPDATES; Start += BENCHMARK_ACL_CHANGE_INTERVAL)
+		{
+			ChangeOwner();
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < BENCHMARK_ACL_CHANGE_INTERVAL; i++)
+			{
+				if (bInvalidateEveryUpdate)
+				{
+					Channel->InvalidateConditionMapFilter();
+				}
+				OutOwnerOnlyRelevant += Channel->GetConditionMapFilter(/* bIsClient */ true).IsRelevant(COND_OwnerOnly) ? 1 : 0;
+			}
+			Seconds += FPlatformTime::Seconds() - StartTime;
+		}
+		return Seconds;
+	};
+
+	int32 RebuiltOwnerOnlyRelevant = 0;
+	const double RebuiltSeconds = RunUpdates(/* bInvalidateEveryUpdate */ true, RebuiltOwnerOnlyRelevant);
+
+	int32 CachedOwnerOnlyRelevant = 0;
+	const double CachedSeconds = RunUpdates(/* bInvalidateEveryUpdate */ false, CachedOwnerOnlyRelevant);
+
+	TestEqual(TEXT("Another client's entity isn't owned when rebuilt per update"), RebuiltOwnerOnlyRelevant, 0);
+	TestEqual(TEXT("Another client's entity isn't owned when cached"), CachedOwnerOnlyRelevant, 0);
+	TestTrue(TEXT("Simulated proxy conditions are relevant"), Channel->GetConditionMapFilter(/* bIsClient */ true).IsRelevant(COND_SimulatedOnly));
+
+	// Role changes are picked up without an ACL change.
+	Actor->Role = ROLE_AutonomousProxy;
+	TestFalse(TEXT("Simulated proxy conditions stop being relevant once the role changes"), Channel->GetConditionMapFilter(/* bIsClient */ true).IsRelevant(COND_SimulatedOnly));
+
+	const SpatialGDK::EntityAcl* EntityACL = StaticComponentView->GetComponentData<SpatialGDK::EntityAcl>(BENCHMARK_ENTITY_ID);
+	TestTrue(TEXT("ACL changes reach the static component view"), EntityACL != nullptr &&
+		USpatialActorChannel::IsClientEndpointOwnedBy(*EntityACL, { FString::Printf(TEXT("workerId:UnrealClient-Owner%d"), NumAclChanges % 2) }));
+
+	AddInfo(FString::Printf(TEXT("%d updates, ACL changed every %d: rebuilt per update %.3fms (%.1fns each), cached %.3fms (%.1fns each)"),
+		BENCHMARK_NUM_UPDATES, BENCHMARK_ACL_CHANGE_INTERVAL,
+		RebuiltSeconds * 1000.0, RebuiltSeconds * 1e9 / BENCHMARK_NUM_UPDATES,
+		CachedSeconds * 1000.0, CachedSeconds * 1e9 / BENCHMARK_NUM_UPDATES));
+
+	NetDriver->RemoveActorChannel(BENCHMARK_ENTITY_ID);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
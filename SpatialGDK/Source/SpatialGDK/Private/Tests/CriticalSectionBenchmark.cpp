@@ -0,0 +1,141 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/SpatialReceiver.h"
+
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/SpatialClassInfoManager.h"
+#include "Interop/SpatialSender.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "SpatialConstants.h"
+#include "Utils/SchemaDatabase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+
+const int32 BENCHMARK_NUM_ENTITIES = 10000;
+// Also run at a tenth of the size, leaving the critical section should scale linearly with the number of components.
+const int32 BENCHMARK_SMALL_NUM_ENTITIES = 1000;
+const int32 BENCHMARK_NUM_COMPONENTS_PER_ENTITY = 8;
+const Worker_ComponentId BENCHMARK_FIRST_COMPONENT_ID = 10000;
+
+struct FCriticalSectionTimings
+{
+	double AddComponentsSeconds = 0.0;
+	double LeaveSeconds = 0.0;
+};
+
+// Checks out NumEntities entities in one critical section on a real USpatialReceiver: every entity's EntityAcl and Position,
+// then its generated components, interleaved across entities the way they arrive in an op list. The entities carry no
+// UnrealMetadata, so ReceiveActor looks at each one and its pending components are thrown away without spawning an Actor.
+FCriticalSectionTimings RunCriticalSection(int32 NumEntities)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::None, /* bInformEngineOfWorld */ false);
+
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	NetDriver->World = World;
+	NetDriver->ClassInfoManager = NewObject<USpatialClassInfoManager>();
+	NetDriver->ClassInfoManager->SchemaDatabase = NewObject<USchemaDatabase>();
+	NetDriver->StaticComponentView = NewObject<USpatialStaticComponentView>();
+	NetDriver->Sender = NewObject<USpatialSender>();
+	NetDriver->Receiver = NewObject<USpatialReceiver>();
+	NetDriver->Sender->Init(NetDriver, nullptr);
+	NetDriver->Receiver->Init(NetDriver, nullptr);
+
+	USpatialStaticComponentView* StaticComponentView = NetDriver->StaticComponentView;
+	USpatialReceiver* Receiver = NetDriver->Receiver;
+
+	TArray<Worker_AddComponentOp> AddComponentOps;
+	AddComponentOps.Reserve(NumEntities * (BENCHMARK_NUM_COMPONENTS_PER_ENTITY + 2));
+	auto AddComponentOp = [&AddComponentOps](Worker_EntityId EntityId, Worker_ComponentData Data)
+	{
+		Worker_AddComponentOp Op = {};
+		Op.entity_id = EntityId;
+		Op.data = Data;
+		AddComponentOps.Add(Op);
+	};
+
+	for (Worker_EntityId EntityId = 1; EntityId <= NumEntities; EntityId++)
+	{
+		SpatialGDK::EntityAcl Acl;
+		AddComponentOp(EntityId, Acl.CreateEntityAclData());
+		SpatialGDK::Position EntityPosition(SpatialGDK::Coordinates{ double(EntityId), 0.0, 0.0 });
+		AddComponentOp(EntityId, EntityPosition.CreatePositionData());
+	}
+	for (int32 i = 0; i < BENCHMARK_NUM_COMPONENTS_PER_ENTITY; i++)
+	{
+		const Worker_ComponentId ComponentId = BENCHMARK_FIRST_COMPONENT_ID + i;
+		for (Worker_EntityId EntityId = 1; EntityId <= NumEntities; EntityId++)
+		{
+			Worker_ComponentData Data = {};
+			Data.component_id = ComponentId;
+			Data.schema_type = Schema_CreateComponentData(ComponentId);
+			Schema_AddUint32(Schema_GetComponentDataFields(Data.schema_type), 1, uint32(EntityId));
+			AddComponentOp(EntityId, Data);
+		}
+	}
+
+	FCriticalSectionTimings Timings;
+
+	const double AddStartTime = FPlatformTime::Seconds();
+	Receiver->OnCriticalSection(true);
+	for (Worker_EntityId EntityId = 1; EntityId <= NumEntities; EntityId++)
+	{
+		Worker_AddEntityOp AddEntityOp = {};
+		AddEntityOp.entity_id = EntityId;
+		Receiver->OnAddEntity(AddEntityOp);
+	}
+	for (const Worker_AddComponentOp& Op : AddComponentOps)
+	{
+		// The same order USpatialDispatcher hands add component ops over in.
+		StaticComponentView->OnAddComponent(Op);
+		Receiver->OnAddComponent(Op);
+	}
+	Timings.AddComponentsSeconds = FPlatformTime::Seconds() - AddStartTime;
+
+	const double LeaveStartTime = FPlatformTime::Seconds();
+	Receiver->OnCriticalSection(false);
+	Timings.LeaveSeconds = FPlatformTime::Seconds() - LeaveStartTime;
+
+	for (Worker_AddComponentOp& Op : AddComponentOps)
+	{
+		Schema_DestroyComponentData(Op.data.schema_type);
+	}
+
+	NetDriver->World = nullptr;
+	World->DestroyWorld(/* bInformEngineOfWorld */ false);
+
+	return Timings;
+}
+
+} // anonymous namespace
+
+// 10k entities checked out in one critical section, as when a server gains a dense area. Times the real receiver queuing
+// the add component ops, and then leaving the critical section, which visits each entity's pending components.
+// The same is run for 1k entities, to show the time to leave grows with the number of components and not their square.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCriticalSection10kEntitiesBenchmark, "SpatialGDK.Interop.Receiver.CriticalSection10kEntitiesBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FCriticalSection10kEntitiesBenchmark::RunTest(const FString& Parameters)
+{
+	const FCriticalSectionTimings SmallTimings = RunCriticalSection(BENCHMARK_SMALL_NUM_ENTITIES);
+	const FCriticalSectionTimings Timings = RunCriticalSection(BENCHMARK_NUM_ENTITIES);
+
+	const double EntityRatio = double(BENCHMARK_NUM_ENTITIES) / BENCHMARK_SMALL_NUM_ENTITIES;
+	const double LeaveRatio = SmallTimings.LeaveSeconds > 0.0 ? Timings.LeaveSeconds / SmallTimings.LeaveSeconds : 0.0;
+
+	AddInfo(FString::Printf(TEXT("%d entities with %d generated components each: OnAddComponent %.2fms, LeaveCriticalSection %.2fms (%.2fus per entity)"),
+		BENCHMARK_NUM_ENTITIES, BENCHMARK_NUM_COMPONENTS_PER_ENTITY,
+		Timings.AddComponentsSeconds * 1000.0, Timings.LeaveSeconds * 1000.0, Timings.LeaveSeconds * 1e6 / BENCHMARK_NUM_ENTITIES));
+	AddInfo(FString::Printf(TEXT("%d entities: OnAddComponent %.2fms, LeaveCriticalSection %.2fms; %.0fx the entities took %.1fx as long to leave"),
+		BENCHMARK_SMALL_NUM_ENTITIES,
+		SmallTimings.AddComponentsSeconds * 1000.0, SmallTimings.LeaveSeconds * 1000.0, EntityRatio, LeaveRatio));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
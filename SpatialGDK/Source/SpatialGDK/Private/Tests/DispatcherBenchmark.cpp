@@ -0,0 +1,133 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/SpatialDispatcher.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/SpatialReceiver.h"
+#include "Interop/SpatialSender.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "SpatialConstants.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+
+const int32 BENCHMARK_NUM_OP_LISTS = 200;
+const int32 BENCHMARK_OPS_PER_LIST = 500;
+const int32 BENCHMARK_NUM_CALLBACK_COMPONENTS = 100;
+// Every tenth op is picked out and processed early, the way the startup flow handles ops it has to see before the rest.
+const int32 BENCHMARK_SELECTED_OP_INTERVAL = 10;
+
+} // anonymous namespace
+
+// A startup op stream of 100k ops queued in 200 op lists, dispatched by a real USpatialDispatcher: component updates for
+// external schema components with user callbacks registered, interleaved with metrics ops. A tenth of the ops is
+// processed on its own first and marked to skip, as SelectiveProcessOps does, then every list is processed in full.
+// Reports ops/sec for the full pass, and for the same stream with nothing marked to skip.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDispatcherStartupOpsBenchmark, "SpatialGDK.Interop.Dispatcher.StartupOpsBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FDispatcherStartupOpsBenchmark::RunTest(const FString& Parameters)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	NetDriver->StaticComponentView = NewObject<USpatialStaticComponentView>();
+	NetDriver->Sender = NewObject<USpatialSender>();
+	NetDriver->Receiver = NewObject<USpatialReceiver>();
+	NetDriver->Dispatcher = NewObject<USpatialDispatcher>();
+	NetDriver->Sender->Init(NetDriver, nullptr);
+	NetDriver->Receiver->Init(NetDriver, nullptr);
+	NetDriver->Dispatcher->Init(NetDriver);
+
+	USpatialDispatcher* Dispatcher = NetDriver->Dispatcher;
+
+	int32 NumCallbacksRun = 0;
+	for (int32 i = 0; i < BENCHMARK_NUM_CALLBACK_COMPONENTS; i++)
+	{
+		Dispatcher->OnComponentUpdate(SpatialConstants::MIN_EXTERNAL_SCHEMA_ID + i, [&NumCallbacksRun](const Worker_ComponentUpdateOp&)
+		{
+			NumCallbacksRun++;
+		});
+	}
+
+	const int32 NumOps = BENCHMARK_NUM_OP_LISTS * BENCHMARK_OPS_PER_LIST;
+
+	TArray<TArray<Worker_Op>> OpStorage;
+	OpStorage.SetNum(BENCHMARK_NUM_OP_LISTS);
+	TArray<Worker_OpList> OpLists;
+	OpLists.SetNum(BENCHMARK_NUM_OP_LISTS);
+	int32 NumComponentUpdates = 0;
+	for (int32 ListIndex = 0; ListIndex < BENCHMARK_NUM_OP_LISTS; ListIndex++)
+	{
+		TArray<Worker_Op>& Ops = OpStorage[ListIndex];
+		Ops.SetNumZeroed(BENCHMARK_OPS_PER_LIST);
+		for (int32 i = 0; i < BENCHMARK_OPS_PER_LIST; i++)
+		{
+			Worker_Op& Op = Ops[i];
+			if (i % 4 == 3)
+			{
+				Op.op_type = WORKER_OP_TYPE_METRICS;
+				continue;
+			}
+
+			Op.op_type = WORKER_OP_TYPE_COMPONENT_UPDATE;
+			Op.component_update.entity_id = 1 + (ListIndex * BENCHMARK_OPS_PER_LIST + i) % 5000;
+			Op.component_update.update.component_id = SpatialConstants::MIN_EXTERNAL_SCHEMA_ID + i % BENCHMARK_NUM_CALLBACK_COMPONENTS;
+			NumComponentUpdates++;
+		}
+
+		OpLists[ListIndex].ops = Ops.GetData();
+		OpLists[ListIndex].op_count = Ops.Num();
+	}
+
+	auto ProcessAllOpLists = [Dispatcher, &OpLists]()
+	{
+		for (Worker_OpList& OpList : OpLists)
+		{
+			Dispatcher->ProcessOps(&OpList);
+		}
+	};
+
+	const double UnskippedStartTime = FPlatformTime::Seconds();
+	ProcessAllOpLists();
+	const double UnskippedSeconds = FPlatformTime::Seconds() - UnskippedStartTime;
+
+	TestEqual(TEXT("Every component update runs its callback"), NumCallbacksRun, NumComponentUpdates);
+
+	NumCallbacksRun = 0;
+	int32 NumSelectedOps = 0;
+	const double SelectedStartTime = FPlatformTime::Seconds();
+	for (TArray<Worker_Op>& Ops : OpStorage)
+	{
+		for (int32 i = 0; i < Ops.Num(); i += BENCHMARK_SELECTED_OP_INTERVAL)
+		{
+			Worker_OpList SingleOpList;
+			SingleOpList.op_count = 1;
+			SingleOpList.ops = &Ops[i];
+
+			Dispatcher->ProcessOps(&SingleOpList);
+			Dispatcher->MarkOpToSkip(&Ops[i]);
+			NumSelectedOps++;
+		}
+	}
+	const double SelectedSeconds = FPlatformTime::Seconds() - SelectedStartTime;
+
+	const double SkippingStartTime = FPlatformTime::Seconds();
+	ProcessAllOpLists();
+	const double SkippingSeconds = FPlatformTime::Seconds() - SkippingStartTime;
+
+	TestEqual(TEXT("Selected ops aren't run twice"), NumCallbacksRun, NumComponentUpdates);
+	TestEqual(TEXT("Every skipped op is forgotten once it's been seen"), Dispatcher->GetNumOpsToSkip(), 0);
+
+	AddInfo(FString::Printf(TEXT("%d ops: nothing skipped %.3fms (%.0f ops/s); %d selected first %.3fms, then with them skipped %.3fms (%.0f ops/s)"),
+		NumOps,
+		UnskippedSeconds * 1000.0, NumOps / UnskippedSeconds,
+		NumSelectedOps, SelectedSeconds * 1000.0,
+		SkippingSeconds * 1000.0, NumOps / SkippingSeconds));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
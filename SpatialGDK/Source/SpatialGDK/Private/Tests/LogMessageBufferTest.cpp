@@ -0,0 +1,59 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/LogMessageBuffer.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace SpatialGDK;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLogMessageBufferLongMessagesTest, "SpatialGDK.Interop.LogMessageBuffer.LongMessages",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FLogMessageBufferLongMessagesTest::RunTest(const FString& Parameters)
+{
+	FLogMessageBuffer Buffer;
+
+	const FString ShortMessage = TEXT("Short message");
+	const FString LongMessage = FString::ChrN(FBufferedLogMessage::MAX_MESSAGE_BYTES * 4, TEXT('a'));
+	const int32 HugeMessageLength = FBufferedLogMessage::MAX_OVERFLOW_MESSAGE_BYTES * 2;
+	const FString HugeMessage = FString::ChrN(HugeMessageLength, TEXT('b'));
+
+	TestTrue(TEXT("Short message is pushed"), Buffer.Push(0, TEXT("Test"), *ShortMessage));
+	TestTrue(TEXT("Message longer than a slot is pushed"), Buffer.Push(0, TEXT("Test"), *LongMessage));
+	TestTrue(TEXT("Message longer than the overflow limit is pushed"), Buffer.Push(0, TEXT("Test"), *HugeMessage));
+
+	FBufferedLogMessage Message;
+
+	TestTrue(TEXT("Short message is popped"), Buffer.Pop(Message));
+	TestEqual(TEXT("Short message is kept in the slot"), FString(UTF8_TO_TCHAR(Message.GetMessage())), ShortMessage);
+
+	TestTrue(TEXT("Long message is popped"), Buffer.Pop(Message));
+	TestEqual(TEXT("Long message is kept in full"), Message.Length, LongMessage.Len());
+	TestEqual(TEXT("Long message is unchanged"), FString(UTF8_TO_TCHAR(Message.GetMessage())), LongMessage);
+
+	TestTrue(TEXT("Huge message is popped"), Buffer.Pop(Message));
+	TestTrue(TEXT("Huge message is cut short"), Message.Length <= FBufferedLogMessage::MAX_OVERFLOW_MESSAGE_BYTES);
+	const FString Truncated = UTF8_TO_TCHAR(Message.GetMessage());
+	TestTrue(TEXT("Huge message keeps its start"), Truncated.StartsWith(TEXT("bbbb")));
+	const int32 MarkerStart = Truncated.Find(TEXT("[truncated "));
+	TestTrue(TEXT("Huge message ends in a truncation marker"), MarkerStart != INDEX_NONE && Truncated.EndsWith(TEXT(" bytes]")));
+	if (MarkerStart != INDEX_NONE)
+	{
+		// The kept characters plus the reported count add up to the original length.
+		const int32 NumKept = MarkerStart - 1;
+		const int32 NumReported = FCString::Atoi(*Truncated.Mid(MarkerStart + 11));
+		TestEqual(TEXT("Marker reports the bytes left out"), NumKept + NumReported, HugeMessageLength);
+	}
+
+	// A slot whose overflow was moved out takes a short message again.
+	TestTrue(TEXT("Short message is pushed after long ones"), Buffer.Push(0, TEXT("Test"), *ShortMessage));
+	TestTrue(TEXT("Short message is popped after long ones"), Buffer.Pop(Message));
+	TestEqual(TEXT("Short message isn't mixed up with an earlier long one"), FString(UTF8_TO_TCHAR(Message.GetMessage())), ShortMessage);
+
+	TestFalse(TEXT("Nothing else is buffered"), Buffer.Pop(Message));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
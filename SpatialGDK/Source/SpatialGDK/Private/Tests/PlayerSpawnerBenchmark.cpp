@@ -0,0 +1,87 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/SpatialPlayerSpawner.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Net/DataBunch.h"
+
+#include "SpatialConstants.h"
+#include "Utils/SchemaUtils.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+
+const int32 BENCHMARK_NUM_PLAYERS = 5000;
+// Clients that time out while queued and send their spawn request again.
+const int32 BENCHMARK_NUM_RETRIES = 1000;
+
+// The payload SendPlayerSpawnCommand builds on clients.
+Schema_CommandRequest* CreatePlayerSpawnRequest()
+{
+	Schema_CommandRequest* Request = Schema_CreateCommandRequest(SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID, SpatialConstants::PLAYER_SPAWNER_SPAWN_PLAYER_COMMAND_ID);
+	Schema_Object* RequestObject = Schema_GetCommandRequestObject(Request);
+
+	SpatialGDK::AddStringToSchema(RequestObject, 1, TEXT("/Game/Maps/Benchmark?Name=BenchmarkPlayer"));
+
+	FUniqueNetIdRepl UniqueId;
+	FNetBitWriter UniqueIdWriter(0);
+	UniqueIdWriter << UniqueId;
+	SpatialGDK::AddBytesToSchema(RequestObject, 2, UniqueIdWriter);
+
+	SpatialGDK::AddStringToSchema(RequestObject, 3, TEXT("Null"));
+	Schema_AddBool(RequestObject, 4, true);
+
+	return Request;
+}
+
+} // anonymous namespace
+
+// A login storm against a spawner stand-in without a net driver: times admitting spawn requests from 5000 simulated players,
+// plus 1000 retries from clients still waiting in the queue. Players are accepted later, PlayerSpawnsPerTick at a time.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlayerSpawnerAdmissionBenchmark, "SpatialGDK.Interop.PlayerSpawner.AdmissionBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FPlayerSpawnerAdmissionBenchmark::RunTest(const FString& Parameters)
+{
+	USpatialPlayerSpawner* PlayerSpawner = NewObject<USpatialPlayerSpawner>();
+	Schema_CommandRequest* Request = CreatePlayerSpawnRequest();
+	Schema_Object* Payload = Schema_GetCommandRequestObject(Request);
+
+	// Caller attributes arrive as UTF-8 in the command request op.
+	TArray<TArray<ANSICHAR>> WorkerAttributes;
+	WorkerAttributes.SetNum(BENCHMARK_NUM_PLAYERS);
+	for (int32 i = 0; i < BENCHMARK_NUM_PLAYERS; i++)
+	{
+		FTCHARToUTF8 WorkerAttribute(*FString::Printf(TEXT("workerId:SimulatedPlayer%d"), i));
+		WorkerAttributes[i].Append(WorkerAttribute.Get(), WorkerAttribute.Length() + 1);
+	}
+
+	Worker_RequestId NextRequestId = 1;
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < BENCHMARK_NUM_PLAYERS; i++)
+	{
+		PlayerSpawner->ReceivePlayerSpawnRequest(Payload, WorkerAttributes[i].GetData(), NextRequestId++, SpatialConstants::INITIAL_SPAWNER_ENTITY_ID);
+	}
+	for (int32 i = 0; i < BENCHMARK_NUM_RETRIES; i++)
+	{
+		PlayerSpawner->ReceivePlayerSpawnRequest(Payload, WorkerAttributes[i].GetData(), NextRequestId++, SpatialConstants::INITIAL_SPAWNER_ENTITY_ID);
+	}
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	Schema_DestroyCommandRequest(Request);
+
+	TestEqual(TEXT("Every player is queued once"), PlayerSpawner->GetNumPendingPlayerSpawns(), BENCHMARK_NUM_PLAYERS);
+
+	const int32 NumRequests = BENCHMARK_NUM_PLAYERS + BENCHMARK_NUM_RETRIES;
+	AddInfo(FString::Printf(TEXT("Admitted %d spawn requests (%d retries) in %.2fms, %.0f requests per second"),
+		NumRequests, BENCHMARK_NUM_RETRIES, ElapsedSeconds * 1000.0, ElapsedSeconds > 0.0 ? NumRequests / ElapsedSeconds : 0.0));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,348 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ComponentReader.h"
+
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Net/RepLayout.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+#include "EngineClasses/SpatialActorChannel.h"
+#include "EngineClasses/SpatialNetConnection.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/SpatialClassInfoManager.h"
+#include "Interop/SpatialSender.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "Utils/ComponentFactory.h"
+#include "Utils/SchemaDatabase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const int32 BENCHMARK_NUM_PROPERTIES = 200;
+// Property kinds the synthetic class cycles through, see CreateBenchmarkProperty.
+const int32 BENCHMARK_NUM_PROPERTY_KINDS = 10;
+const int32 BENCHMARK_ARRAY_NUM = 4;
+const int32 BENCHMARK_NUM_UPDATES = 1000;
+const Worker_EntityId BENCHMARK_ENTITY_ID = 1;
+const Worker_ComponentId BENCHMARK_COMPONENT_ID = 100000;
+
+UProperty* CreateBenchmarkProperty(UClass* Class, int32 Index)
+{
+	const FName Name(*FString::Printf(TEXT("BenchmarkProperty_%d"), Index));
+
+	switch (Index % BENCHMARK_NUM_PROPERTY_KINDS)
+	{
+	case 0:
+	{
+		UBoolProperty* BoolProperty = NewObject<UBoolProperty>(Class, Name, RF_Public);
+		BoolProperty->SetBoolSize(sizeof(bool), /* bIsNativeBool */ true);
+		return BoolProperty;
+	}
+	case 1:
+		return NewObject<UFloatProperty>(Class, Name, RF_Public);
+	case 2:
+		return NewObject<UIntProperty>(Class, Name, RF_Public);
+	case 3:
+	{
+		UByteProperty* ByteProperty = NewObject<UByteProperty>(Class, Name, RF_Public);
+		ByteProperty->Enum = FindObject<UEnum>(ANY_PACKAGE, TEXT("ENetRole"), /* ExactClass */ true);
+		return ByteProperty;
+	}
+	case 4:
+		return NewObject<UDoubleProperty>(Class, Name, RF_Public);
+	case 5:
+		return NewObject<UStrProperty>(Class, Name, RF_Public);
+	case 6:
+		return NewObject<UNameProperty>(Class, Name, RF_Public);
+	case 7:
+	{
+		UStructProperty* StructProperty = NewObject<UStructProperty>(Class, Name, RF_Public);
+		StructProperty->Struct = TBaseStructure<FVector>::Get();
+		return StructProperty;
+	}
+	case 8:
+	{
+		UEnumProperty* EnumProperty = NewObject<UEnumProperty>(Class, Name, RF_Public);
+		EnumProperty->SetEnum(FindObject<UEnum>(ANY_PACKAGE, TEXT("ESpawnActorCollisionHandlingMethod"), /* ExactClass */ true));
+		EnumProperty->AddCppProperty(NewObject<UByteProperty>(EnumProperty, TEXT("UnderlyingType"), RF_Public));
+		return EnumProperty;
+	}
+	default:
+	{
+		UArrayProperty* ArrayProperty = NewObject<UArrayProperty>(Class, Name, RF_Public);
+		ArrayProperty->AddCppProperty(NewObject<UIntProperty>(ArrayProperty, Name, RF_Public));
+		return ArrayProperty;
+	}
+	}
+}
+
+// An Actor class with 200 replicated properties of mixed kinds, built the way the Blueprint compiler builds one,
+// so AActor::GetLifetimeReplicatedProps picks them up and the net driver makes a real FRepLayout for it.
+UClass* CreateBenchmarkClass()
+{
+	UClass* SuperClass = AActor::StaticClass();
+
+	const FName ClassName = MakeUniqueObjectName(GetTransientPackage(), UBlueprintGeneratedClass::StaticClass(), TEXT("SpatialBenchmarkReplicatedActorClass"));
+	UBlueprintGeneratedClass* Class = NewObject<UBlueprintGeneratedClass>(GetTransientPackage(), ClassName, RF_Public | RF_Transient);
+	Class->SetSuperStruct(SuperClass);
+	Class->ClassFlags |= (SuperClass->ClassFlags & CLASS_Inherit);
+	Class->ClassCastFlags |= SuperClass->ClassCastFlags;
+	Class->ClassWithin = SuperClass->ClassWithin;
+	Class->ClassConfigName = SuperClass->ClassConfigName;
+
+	// AddCppProperty prepends, so add them last to first to keep the rep handles in declaration order.
+	for (int32 i = BENCHMARK_NUM_PROPERTIES - 1; i >= 0; i--)
+	{
+		UProperty* Property = CreateBenchmarkProperty(Class, i);
+		Property->SetPropertyFlags(CPF_Net);
+		Class->AddCppProperty(Property);
+	}
+	Class->NumReplicatedProperties = BENCHMARK_NUM_PROPERTIES;
+
+	Class->Bind();
+	Class->StaticLink(/* bRelinkExistingProperties */ true);
+	Class->AssembleReferenceTokenStream(/* bForce */ true);
+	Class->SetUpRuntimeReplicationData();
+	Class->GetDefaultObject();
+
+	return Class;
+}
+
+void SetBenchmarkValue(UProperty* Property, void* Data, int32 Seed)
+{
+	if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
+	{
+		BoolProperty->SetPropertyValue(Data, true);
+	}
+	else if (UNumericProperty* NumericProperty = Cast<UNumericProperty>(Property))
+	{
+		if (NumericProperty->IsFloatingPoint())
+		{
+			NumericProperty->SetFloatingPointPropertyValue(Data, Seed + 0.5);
+		}
+		else
+		{
+			// Small enough for every byte and enum property to hold a valid value.
+			NumericProperty->SetIntPropertyValue(Data, uint64(Seed % 3 + 1));
+		}
+	}
+	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
+	{
+		SetBenchmarkValue(EnumProperty->GetUnderlyingProperty(), Data, Seed);
+	}
+	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
+	{
+		StrProperty->SetPropertyValue(Data, FString::Printf(TEXT("BenchmarkValue_%d"), Seed));
+	}
+	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
+	{
+		NameProperty->SetPropertyValue(Data, FName(*FString::Printf(TEXT("BenchmarkName_%d"), Seed)));
+	}
+	else if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	{
+		check(StructProperty->Struct == TBaseStructure<FVector>::Get());
+		*static_cast<FVector*>(Data) = FVector(Seed, Seed + 1.0f, Seed + 2.0f);
+	}
+	else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
+	{
+		FScriptArrayHelper ArrayHelper(ArrayProperty, Data);
+		ArrayHelper.Resize(BENCHMARK_ARRAY_NUM);
+		for (int32 i = 0; i < BENCHMARK_ARRAY_NUM; i++)
+		{
+			SetBenchmarkValue(ArrayProperty->Inner, ArrayHelper.GetRawPtr(i), Seed + i);
+		}
+	}
+}
+
+// The changelist USpatialActorChannel::CreateInitialRepChangeState builds, limited to the properties Class declares itself.
+// AActor's own replicated properties include object references, which would need a package map to write and read.
+TArray<uint16> CreateChangelistForClassProperties(const FRepLayout& RepLayout, const UClass* Class)
+{
+	TArray<uint16> RepChanged;
+
+	const TArray<FRepLayoutCmd>& Cmds = RepLayout.Cmds;
+	for (int32 CmdIdx = 0; CmdIdx < Cmds.Num();)
+	{
+		const FRepLayoutCmd& Cmd = Cmds[CmdIdx];
+		const int32 NextCmdIdx = Cmd.Type == ERepLayoutCmdType::DynamicArray ? Cmd.EndCmd : CmdIdx + 1;
+
+		// The Return left at the root level terminates the changelist.
+		if (Cmd.Type == ERepLayoutCmdType::Return || RepLayout.Parents[Cmd.ParentIndex].Property->GetOwnerClass() == Class)
+		{
+			RepChanged.Add(Cmd.RelativeHandle);
+
+			if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
+			{
+				RepChanged.Add((Cmd.EndCmd - CmdIdx) - 2);
+				for (int32 ElementCmdIdx = CmdIdx + 1; ElementCmdIdx < Cmd.EndCmd; ElementCmdIdx++)
+				{
+					RepChanged.Add(Cmds[ElementCmdIdx].RelativeHandle);
+				}
+			}
+		}
+
+		CmdIdx = NextCmdIdx;
+	}
+
+	return RepChanged;
+}
+
+int32 CountIdenticalProperties(const UClass* Class, const AActor* Source, const AActor* Target)
+{
+	int32 NumIdentical = 0;
+	for (TFieldIterator<UProperty> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		if (It->Identical_InContainer(Source, Target))
+		{
+			NumIdentical++;
+		}
+	}
+	return NumIdentical;
+}
+
+} // anonymous namespace
+
+// A server receiving 1000 updates, each changing all 200 replicated properties of an Actor class with a mix of bools,
+// numbers, enums, strings, names, structs and arrays, applied by ComponentReader through a real channel. First with
+// a class info manager that hasn't seen the class before every update, so GetOrCreateRepApplyPlan resolves how to apply
+// every field again each time, as ComponentReader did per field before the plan. Then with the plan cached per class.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPropertyApplyPlanComponentReaderBenchmark, "SpatialGDK.Utils.PropertyApplyPlan.ComponentReaderBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FPropertyApplyPlanComponentReaderBenchmark::RunTest(const FString& Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::None, /* bInformEngineOfWorld */ false);
+
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	NetDriver->World = World;
+	NetDriver->GuidCache = MakeShareable(new FNetGUIDCache(NetDriver));
+	NetDriver->ClassInfoManager = NewObject<USpatialClassInfoManager>();
+	NetDriver->ClassInfoManager->SchemaDatabase = NewObject<USchemaDatabase>();
+	NetDriver->StaticComponentView = NewObject<USpatialStaticComponentView>();
+	NetDriver->Sender = NewObject<USpatialSender>();
+	NetDriver->Receiver = NewObject<USpatialReceiver>();
+	NetDriver->Sender->Init(NetDriver, nullptr);
+	NetDriver->Receiver->Init(NetDriver, nullptr);
+
+	USpatialClassInfoManager* ClassInfoManager = NetDriver->ClassInfoManager;
+
+	UClass* Class = CreateBenchmarkClass();
+	AActor* SourceActor = NewObject<AActor>(GetTransientPackage(), Class);
+	AActor* TargetActor = NewObject<AActor>(GetTransientPackage(), Class);
+	NetDriver->GuidCache->AssignNewNetGUID_Server(SourceActor);
+	NetDriver->GuidCache->AssignNewNetGUID_Server(TargetActor);
+
+	int32 NumProperties = 0;
+	for (TFieldIterator<UProperty> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		SetBenchmarkValue(*It, It->ContainerPtrToValuePtr<void>(SourceActor), NumProperties++);
+	}
+	TestEqual(TEXT("The benchmark class has every replicated property"), NumProperties, BENCHMARK_NUM_PROPERTIES);
+	TestEqual(TEXT("No property starts out applied"), CountIdenticalProperties(Class, SourceActor, TargetActor), 0);
+
+	USpatialNetConnection* NetConnection = NewObject<USpatialNetConnection>();
+	NetConnection->Driver = NetDriver;
+
+	USpatialActorChannel* Channel = NewObject<USpatialActorChannel>();
+#if ENGINE_MINOR_VERSION <= 20
+	Channel->Init(NetConnection, 1, /* bOpenedLocally */ false);
+#else
+	Channel->Init(NetConnection, 1, EChannelCreateFlags::None);
+#endif
+	Channel->Actor = TargetActor;
+	Channel->SetEntityId(BENCHMARK_ENTITY_ID);
+	NetDriver->AddActorChannel(BENCHMARK_ENTITY_ID, Channel);
+
+	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetObjectClassRepLayout(Class);
+	const FRepChangeState Changes = { CreateChangelistForClassProperties(*RepLayout, Class), *RepLayout };
+
+	FClassInfo Info;
+	Info.Class = Class;
+	Info.SchemaComponents[SCHEMA_Data] = BENCHMARK_COMPONENT_ID;
+
+	FUnresolvedObjectsMap RepUnresolvedObjectsMap;
+	FUnresolvedObjectsMap HandoverUnresolvedObjectsMap;
+	ComponentFactory Factory(RepUnresolvedObjectsMap, HandoverUnresolvedObjectsMap, /* bInterestDirty */ false, NetDriver);
+	TArray<Worker_ComponentUpdate> Updates = Factory.CreateComponentUpdates(SourceActor, Info, BENCHMARK_ENTITY_ID, &Changes, nullptr);
+	if (!TestEqual(TEXT("The source Actor writes a single data component update"), Updates.Num(), 1))
+	{
+		return false;
+	}
+	const Worker_ComponentUpdate& Update = Updates[0];
+	TestEqual(TEXT("The update carries every property"),
+		int32(Schema_GetUniqueFieldIdCount(Schema_GetComponentUpdateFields(Update.schema_type))), BENCHMARK_NUM_PROPERTIES);
+
+	auto ApplyUpdate = [NetDriver, &Update, TargetActor, Channel]()
+	{
+		FObjectReferencesMap ObjectReferencesMap;
+		TSet<FUnrealObjectRef> UnresolvedRefs;
+		ComponentReader Reader(NetDriver, ObjectReferencesMap, UnresolvedRefs);
+		Reader.ApplyComponentUpdate(Update, TargetActor, Channel, /* bIsHandover */ false);
+	};
+
+	// Creates the replicator and the shadow data, and resolves the plan held by the net driver's class info manager.
+	ApplyUpdate();
+	TestEqual(TEXT("Every property is applied"), CountIdenticalProperties(Class, SourceActor, TargetActor), BENCHMARK_NUM_PROPERTIES);
+
+	TArray<USpatialClassInfoManager*> UnseenClassInfoManagers;
+	UnseenClassInfoManagers.Reserve(BENCHMARK_NUM_UPDATES);
+	for (int32 i = 0; i < BENCHMARK_NUM_UPDATES; i++)
+	{
+		UnseenClassInfoManagers.Add(NewObject<USpatialClassInfoManager>());
+	}
+
+	const double ResolvedPerUpdateStartTime = FPlatformTime::Seconds();
+	for (USpatialClassInfoManager* UnseenClassInfoManager : UnseenClassInfoManagers)
+	{
+		NetDriver->ClassInfoManager = UnseenClassInfoManager;
+		ApplyUpdate();
+	}
+	const double ResolvedPerUpdateSeconds = FPlatformTime::Seconds() - ResolvedPerUpdateStartTime;
+
+	NetDriver->ClassInfoManager = ClassInfoManager;
+
+	const double PlanStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < BENCHMARK_NUM_UPDATES; i++)
+	{
+		ApplyUpdate();
+	}
+	const double PlanSeconds = FPlatformTime::Seconds() - PlanStartTime;
+
+	TestEqual(TEXT("Every property is still applied after the benchmark"), CountIdenticalProperties(Class, SourceActor, TargetActor), BENCHMARK_NUM_PROPERTIES);
+	TestEqual(TEXT("The cached plan covers every replicated property"),
+		ClassInfoManager->GetOrCreateRepApplyPlan(Class, *RepLayout)->Fields.Num(), RepLayout->BaseHandleToCmdIndex.Num());
+
+	const int32 NumFieldsApplied = BENCHMARK_NUM_PROPERTIES * BENCHMARK_NUM_UPDATES;
+	AddInfo(FString::Printf(TEXT("%d updates of %d properties through ComponentReader: resolved per update %.2fms (%.1fns per field), cached plan %.2fms (%.1fns per field)"),
+		BENCHMARK_NUM_UPDATES, BENCHMARK_NUM_PROPERTIES,
+		ResolvedPerUpdateSeconds * 1000.0, ResolvedPerUpdateSeconds * 1e9 / NumFieldsApplied,
+		PlanSeconds * 1000.0, PlanSeconds * 1e9 / NumFieldsApplied));
+
+	for (Worker_ComponentUpdate& ComponentUpdate : Updates)
+	{
+		Schema_DestroyComponentUpdate(ComponentUpdate.schema_type);
+	}
+
+	NetDriver->RemoveActorChannel(BENCHMARK_ENTITY_ID);
+	NetDriver->World = nullptr;
+	World->DestroyWorld(/* bInformEngineOfWorld */ false);
+
+	// Leave the transient class and its Actors to be collected.
+	SourceActor->MarkPendingKill();
+	TargetActor->MarkPendingKill();
+	Class->ClearFlags(RF_Public);
+	Class->MarkPendingKill();
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,131 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/QueuedRemoveComponentOps.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+
+Worker_RemoveComponentOp MakeRemoveComponentOp(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	Worker_RemoveComponentOp Op = {};
+	Op.entity_id = EntityId;
+	Op.component_id = ComponentId;
+	return Op;
+}
+
+TArray<TPair<Worker_EntityId, Worker_ComponentId>> GetFlushedOps(const FQueuedRemoveComponentOps& QueuedOps)
+{
+	TArray<TPair<Worker_EntityId, Worker_ComponentId>> FlushedOps;
+	QueuedOps.ForEach([&FlushedOps](const Worker_RemoveComponentOp& Op)
+	{
+		FlushedOps.Emplace(Op.entity_id, Op.component_id);
+	});
+	return FlushedOps;
+}
+
+} // anonymous namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQueuedRemoveComponentOpsOrderTest, "SpatialGDK.Utils.QueuedRemoveComponentOps.Order",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FQueuedRemoveComponentOpsOrderTest::RunTest(const FString& Parameters)
+{
+	FQueuedRemoveComponentOps QueuedOps;
+	QueuedOps.Add(MakeRemoveComponentOp(1, 100));
+	QueuedOps.Add(MakeRemoveComponentOp(2, 200));
+	QueuedOps.Add(MakeRemoveComponentOp(1, 101));
+	QueuedOps.Add(MakeRemoveComponentOp(3, 300));
+
+	TArray<TPair<Worker_EntityId, Worker_ComponentId>> Expected;
+	Expected.Emplace(1, 100);
+	Expected.Emplace(1, 101);
+	Expected.Emplace(2, 200);
+	Expected.Emplace(3, 300);
+	TestTrue(TEXT("Entities are flushed in arrival order, each with its ops in arrival order"), GetFlushedOps(QueuedOps) == Expected);
+
+	QueuedOps.RemoveEntity(2);
+	TestEqual(TEXT("Removed entity's ops are dropped"), QueuedOps.Num(), 3);
+
+	// An entity that's checked out again in the same op list is flushed after the entities queued in between.
+	QueuedOps.RemoveEntity(1);
+	QueuedOps.Add(MakeRemoveComponentOp(1, 102));
+
+	Expected.Reset();
+	Expected.Emplace(3, 300);
+	Expected.Emplace(1, 102);
+	TestTrue(TEXT("Only ops queued since the entity was removed are flushed, once"), GetFlushedOps(QueuedOps) == Expected);
+
+	// Dropping the last entity queued, then queuing another, keeps the order intact at the end as well.
+	QueuedOps.RemoveEntity(1);
+	QueuedOps.Add(MakeRemoveComponentOp(4, 400));
+
+	Expected.Reset();
+	Expected.Emplace(3, 300);
+	Expected.Emplace(4, 400);
+	TestTrue(TEXT("Entities queued after the last one was dropped follow the remaining ones"), GetFlushedOps(QueuedOps) == Expected);
+	TestEqual(TEXT("Dropped entities' ops aren't counted"), QueuedOps.Num(), 2);
+
+	QueuedOps.Reset();
+	TestEqual(TEXT("Reset drops everything"), QueuedOps.Num(), 0);
+	TestEqual(TEXT("Reset flushes nothing"), GetFlushedOps(QueuedOps).Num(), 0);
+
+	return true;
+}
+
+namespace
+{
+
+const int32 NUM_REMOVED_ENTITIES = 20000;
+const int32 NUM_COMPONENTS_PER_ENTITY = 8;
+
+} // anonymous namespace
+
+// A large area leaving view in one op list: every entity's components are removed and then the entity itself.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQueuedRemoveComponentOpsRemove20kEntitiesTest, "SpatialGDK.Utils.QueuedRemoveComponentOps.Remove20kEntities",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FQueuedRemoveComponentOpsRemove20kEntitiesTest::RunTest(const FString& Parameters)
+{
+	FQueuedRemoveComponentOps QueuedOps;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	for (Worker_EntityId EntityId = 1; EntityId <= NUM_REMOVED_ENTITIES; EntityId++)
+	{
+		for (Worker_ComponentId ComponentId = 0; ComponentId < NUM_COMPONENTS_PER_ENTITY; ComponentId++)
+		{
+			QueuedOps.Add(MakeRemoveComponentOp(EntityId, 1000 + ComponentId));
+		}
+	}
+	TestEqual(TEXT("Every op is queued"), QueuedOps.Num(), NUM_REMOVED_ENTITIES * NUM_COMPONENTS_PER_ENTITY);
+
+	// Keep one entity in view, to check the flush still applies the ops that weren't dropped.
+	for (Worker_EntityId EntityId = 1; EntityId < NUM_REMOVED_ENTITIES; EntityId++)
+	{
+		QueuedOps.RemoveEntity(EntityId);
+	}
+
+	int32 NumFlushed = 0;
+	bool bOnlyKeptEntityFlushed = true;
+	QueuedOps.ForEach([&NumFlushed, &bOnlyKeptEntityFlushed](const Worker_RemoveComponentOp& Op)
+	{
+		NumFlushed++;
+		bOnlyKeptEntityFlushed &= Op.entity_id == NUM_REMOVED_ENTITIES;
+	});
+	QueuedOps.Reset();
+
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual(TEXT("Only the kept entity's ops are flushed"), NumFlushed, NUM_COMPONENTS_PER_ENTITY);
+	TestTrue(TEXT("No removed entity's ops are flushed"), bOnlyKeptEntityFlushed);
+
+	AddInfo(FString::Printf(TEXT("Queued, removed and flushed %d entities with %d components each in %.2fms"),
+		NUM_REMOVED_ENTITIES, NUM_COMPONENTS_PER_ENTITY, ElapsedSeconds * 1000.0));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,165 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/TimingWheel.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "TimerManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+
+// Advances the wheel in frame sized steps, like the net driver does.
+void TickTimingWheelFor(FTimingWheel& TimingWheel, float Seconds)
+{
+	const int32 NumSteps = FMath::RoundToInt(Seconds * 10.0f);
+	for (int32 i = 0; i < NumSteps; i++)
+	{
+		TimingWheel.Tick(0.1f);
+	}
+}
+
+} // anonymous namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimingWheelFiresAfterDelayTest, "SpatialGDK.Utils.TimingWheel.FiresAfterDelay",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FTimingWheelFiresAfterDelayTest::RunTest(const FString& Parameters)
+{
+	FTimingWheel TimingWheel;
+	TArray<int32> Fired;
+
+	// One delay for each level of the wheel.
+	const float Delays[] = { 1.0f, 30.0f, 600.0f, 12000.0f };
+	TArray<FTimingWheelHandle> Handles;
+	Handles.SetNum(ARRAY_COUNT(Delays));
+	for (int32 i = 0; i < ARRAY_COUNT(Delays); i++)
+	{
+		TimingWheel.SetTimer(Handles[i], [&Fired, i]() { Fired.Add(i); }, Delays[i]);
+	}
+	TestEqual(TEXT("All timers are active"), TimingWheel.GetNumActiveTimers(), (int32)ARRAY_COUNT(Delays));
+
+	float Elapsed = 0.0f;
+	for (int32 i = 0; i < ARRAY_COUNT(Delays); i++)
+	{
+		TickTimingWheelFor(TimingWheel, Delays[i] - Elapsed - 0.2f);
+		TestEqual(FString::Printf(TEXT("Timer %d hasn't fired early"), i), Fired.Num(), i);
+
+		TickTimingWheelFor(TimingWheel, 0.4f);
+		TestEqual(FString::Printf(TEXT("Timer %d fired"), i), Fired.Num(), i + 1);
+
+		Elapsed = Delays[i] + 0.2f;
+	}
+
+	TestEqual(TEXT("Timers fired in order"), Fired, TArray<int32>({ 0, 1, 2, 3 }));
+	TestEqual(TEXT("No timers left"), TimingWheel.GetNumActiveTimers(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimingWheelResetAndClearTest, "SpatialGDK.Utils.TimingWheel.ResetAndClear",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FTimingWheelResetAndClearTest::RunTest(const FString& Parameters)
+{
+	FTimingWheel TimingWheel;
+	int32 NumFired = 0;
+
+	FTimingWheelHandle Handle;
+	TimingWheel.SetTimer(Handle, [&NumFired]() { NumFired++; }, 1.0f);
+
+	// Like a heartbeat, keep pushing the timeout back before it expires.
+	for (int32 i = 0; i < 10; i++)
+	{
+		TickTimingWheelFor(TimingWheel, 0.5f);
+		TestTrue(TEXT("Timer reset in place"), TimingWheel.ResetTimer(Handle, 1.0f));
+	}
+	TestEqual(TEXT("Reset timer hasn't fired"), NumFired, 0);
+
+	TickTimingWheelFor(TimingWheel, 1.2f);
+	TestEqual(TEXT("Timer fired once it stopped being reset"), NumFired, 1);
+	TestFalse(TEXT("Fired timer is inactive"), TimingWheel.IsTimerActive(Handle));
+	TestFalse(TEXT("Fired timer can't be reset"), TimingWheel.ResetTimer(Handle, 1.0f));
+
+	TimingWheel.SetTimer(Handle, [&NumFired]() { NumFired++; }, 1.0f);
+	TimingWheel.ClearTimer(Handle);
+	TickTimingWheelFor(TimingWheel, 2.0f);
+	TestEqual(TEXT("Cleared timer didn't fire"), NumFired, 1);
+
+	FTimingWheelHandle LoopHandle;
+	TimingWheel.SetTimer(LoopHandle, [&NumFired]() { NumFired++; }, 1.0f, true);
+	TickTimingWheelFor(TimingWheel, 5.5f);
+	TestEqual(TEXT("Looping timer fired every interval"), NumFired, 6);
+	TestTrue(TEXT("Looping timer is still active"), TimingWheel.IsTimerActive(LoopHandle));
+
+	return true;
+}
+
+namespace
+{
+
+const int32 BENCHMARK_NUM_CONNECTIONS = 1000;
+const int32 BENCHMARK_NUM_FRAMES = 600;
+const float BENCHMARK_FRAME_SECONDS = 1.0f / 60.0f;
+const float BENCHMARK_HEARTBEAT_TIMEOUT_SECONDS = 10.0f;
+
+} // anonymous namespace
+
+// Heartbeat timeouts for 1000 connections, with every connection's timeout re-armed each frame, as on a busy server.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimingWheelHeartbeatBenchmark, "SpatialGDK.Utils.TimingWheel.HeartbeatBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FTimingWheelHeartbeatBenchmark::RunTest(const FString& Parameters)
+{
+	int32 NumTimedOut = 0;
+
+	double TimerManagerSeconds = 0.0;
+	{
+		FTimerManager TimerManager;
+		TArray<FTimerHandle> Handles;
+		Handles.SetNum(BENCHMARK_NUM_CONNECTIONS);
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < BENCHMARK_NUM_FRAMES; Frame++)
+		{
+			for (FTimerHandle& Handle : Handles)
+			{
+				FTimerDelegate Delegate;
+				Delegate.BindLambda([&NumTimedOut]() { NumTimedOut++; });
+				TimerManager.SetTimer(Handle, Delegate, BENCHMARK_HEARTBEAT_TIMEOUT_SECONDS, false);
+			}
+			TimerManager.Tick(BENCHMARK_FRAME_SECONDS);
+		}
+		TimerManagerSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	double TimingWheelSeconds = 0.0;
+	{
+		FTimingWheel TimingWheel;
+		TArray<FTimingWheelHandle> Handles;
+		Handles.SetNum(BENCHMARK_NUM_CONNECTIONS);
+		for (FTimingWheelHandle& Handle : Handles)
+		{
+			TimingWheel.SetTimer(Handle, [&NumTimedOut]() { NumTimedOut++; }, BENCHMARK_HEARTBEAT_TIMEOUT_SECONDS);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < BENCHMARK_NUM_FRAMES; Frame++)
+		{
+			for (FTimingWheelHandle& Handle : Handles)
+			{
+				TimingWheel.ResetTimer(Handle, BENCHMARK_HEARTBEAT_TIMEOUT_SECONDS);
+			}
+			TimingWheel.Tick(BENCHMARK_FRAME_SECONDS);
+		}
+		TimingWheelSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	TestEqual(TEXT("No heartbeat timed out"), NumTimedOut, 0);
+
+	AddInfo(FString::Printf(TEXT("%d connections, %d frames: FTimerManager %.2fms, FTimingWheel %.2fms"),
+		BENCHMARK_NUM_CONNECTIONS, BENCHMARK_NUM_FRAMES, TimerManagerSeconds * 1000.0, TimingWheelSeconds * 1000.0));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -1,6 +1,8 @@
 #include "Utils/ActorGroupManager.h"
 #include "SpatialGDKSettings.h"
 
+#include "UObject/UObjectGlobals.h"
+
 void UActorGroupManager::Init()
 {
 	if (const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>())
@@ -19,48 +21,99 @@ void UActorGroupManager::Init()
 			}
 		}
 	}
+
+	FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UActorGroupManager::RemoveStaleClassActorGroups);
+#if WITH_HOT_RELOAD
+	FCoreUObjectDelegates::RegisterHotReloadAddedClassesDelegate.AddUObject(this, &UActorGroupManager::OnHotReloadAddedClasses);
+#endif
 }
 
-FName UActorGroupManager::GetActorGroupForClass(const TSubclassOf<AActor> Class)
+void UActorGroupManager::BeginDestroy()
 {
-	if (Class == nullptr)
-	{
-		return NAME_None;
-	}
+	FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+#if WITH_HOT_RELOAD
+	FCoreUObjectDelegates::RegisterHotReloadAddedClassesDelegate.RemoveAll(this);
+#endif
 
-	UClass* FoundClass = Class;
-	TSoftClassPtr<AActor> ClassPtr = TSoftClassPtr<AActor>(FoundClass);
+	Super::BeginDestroy();
+}
 
-	while (FoundClass != nullptr && FoundClass->IsChildOf(AActor::StaticClass()))
+void UActorGroupManager::RemoveStaleClassActorGroups()
+{
+	for (auto It = ClassToActorGroup.CreateIterator(); It; ++It)
 	{
-		if (const FName* ActorGroup = ClassPathToActorGroup.Find(ClassPtr))
+		if (!It.Key().IsValid())
 		{
-			if (FoundClass != Class)
-			{
-				ClassPathToActorGroup.Add(TSoftClassPtr<AActor>(Class), *ActorGroup);
-			}
-			return *ActorGroup;
+			It.RemoveCurrent();
 		}
+	}
+}
+
+#if WITH_HOT_RELOAD
+void UActorGroupManager::OnHotReloadAddedClasses(const TArray<UClass*>& AddedClasses)
+{
+	// Reinstanced classes can have a different parent, which the cached entries of their children were resolved through.
+	ClassToActorGroup.Reset();
+}
+#endif
 
-		FoundClass = FoundClass->GetSuperClass();
-		ClassPtr = TSoftClassPtr<AActor>(FoundClass);
+const FClassActorGroup& UActorGroupManager::GetOrResolveClassActorGroup(UClass* Class)
+{
+	if (const FClassActorGroup* Resolved = ClassToActorGroup.Find(Class))
+	{
+		return *Resolved;
 	}
 
-	// No mapping found so set and return default actor group.
-	ClassPathToActorGroup.Add(TSoftClassPtr<AActor>(Class), SpatialConstants::DefaultActorGroup);
+	FClassActorGroup Resolved;
+	Resolved.ActorGroup = ResolveActorGroupForClass(Class);
+	Resolved.WorkerType = GetWorkerTypeForActorGroup(Resolved.ActorGroup);
+
+	return ClassToActorGroup.Add(Class, Resolved);
+}
+
+FName UActorGroupManager::ResolveActorGroupForClass(UClass* Class)
+{
+	// Without offloading every class is in the default actor group, so don't build any class paths.
+	if (ClassPathToActorGroup.Num() == 0 || !Class->IsChildOf(AActor::StaticClass()))
+	{
+		return SpatialConstants::DefaultActorGroup;
+	}
+
+	if (const FName* ActorGroup = ClassPathToActorGroup.Find(TSoftClassPtr<AActor>(Class)))
+	{
+		return *ActorGroup;
+	}
+
+	// Inherit the parent's actor group, resolving and caching it on the way, so classes sharing
+	// ancestors don't build their class paths again.
+	UClass* SuperClass = Class->GetSuperClass();
+	if (SuperClass != nullptr && SuperClass->IsChildOf(AActor::StaticClass()))
+	{
+		return GetOrResolveClassActorGroup(SuperClass).ActorGroup;
+	}
+
+	// No mapping found so return default actor group.
 	return SpatialConstants::DefaultActorGroup;
 }
 
-FName UActorGroupManager::GetWorkerTypeForClass(const TSubclassOf<AActor> Class)
+FName UActorGroupManager::GetActorGroupForClass(const TSubclassOf<AActor> Class)
 {
-	const FName ActorGroup = GetActorGroupForClass(Class);
+	if (Class == nullptr)
+	{
+		return NAME_None;
+	}
 
-	if (const FName* WorkerType = ActorGroupToWorkerType.Find(ActorGroup))
+	return GetOrResolveClassActorGroup(Class).ActorGroup;
+}
+
+FName UActorGroupManager::GetWorkerTypeForClass(const TSubclassOf<AActor> Class)
+{
+	if (Class == nullptr)
 	{
-		return *WorkerType;
+		return GetWorkerTypeForActorGroup(NAME_None);
 	}
 
-	return DefaultWorkerType;
+	return GetOrResolveClassActorGroup(Class).WorkerType;
 }
 
 FName UActorGroupManager::GetWorkerTypeForActorGroup(const FName& ActorGroup) const
@@ -80,8 +133,8 @@ bool UActorGroupManager::IsSameWorkerType(const AActor* ActorA, const AActor* Ac
 		return false;
 	}
 
-	const FName& WorkerTypeA = GetWorkerTypeForClass(ActorA->GetClass());
-	const FName& WorkerTypeB = GetWorkerTypeForClass(ActorB->GetClass());
+	const FName WorkerTypeA = GetOrResolveClassActorGroup(ActorA->GetClass()).WorkerType;
+	const FName WorkerTypeB = GetOrResolveClassActorGroup(ActorB->GetClass()).WorkerType;
 
 	return (WorkerTypeA == WorkerTypeB);
 }
@@ -15,6 +15,7 @@
 #include "SpatialConstants.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/InterestFactory.h"
+#include "Utils/SpatialTracer.h"
 
 namespace SpatialGDK
 {
@@ -344,6 +345,8 @@ TArray<Worker_ComponentData> ComponentFactory::CreateComponentDatas(UObject* Obj
 
 Worker_ComponentData ComponentFactory::CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup)
 {
+	FSpatialTraceScope SerializeTrace(ESpatialTraceEvent::SerializeComponentData, SpatialConstants::INVALID_ENTITY_ID, ComponentId);
+
 	Worker_ComponentData ComponentData = {};
 	ComponentData.component_id = ComponentId;
 	ComponentData.schema_type = Schema_CreateComponentData(ComponentId);
@@ -353,6 +356,11 @@ Worker_ComponentData ComponentFactory::CreateComponentData(Worker_ComponentId Co
 	// is different to what the default state is (the client will have the incorrect data). UNR:959
 	FillSchemaObject(ComponentObject, Object, Changes, PropertyGroup, true);
 
+	if (SerializeTrace.IsActive())
+	{
+		SerializeTrace.SetBytes(Schema_GetWriteBufferLength(ComponentObject));
+	}
+
 	return ComponentData;
 }
 
@@ -367,11 +375,18 @@ Worker_ComponentData ComponentFactory::CreateEmptyComponentData(Worker_Component
 
 Worker_ComponentData ComponentFactory::CreateHandoverComponentData(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes)
 {
+	FSpatialTraceScope SerializeTrace(ESpatialTraceEvent::SerializeComponentData, SpatialConstants::INVALID_ENTITY_ID, ComponentId);
+
 	Worker_ComponentData ComponentData = CreateEmptyComponentData(ComponentId);
 	Schema_Object* ComponentObject = Schema_GetComponentDataFields(ComponentData.schema_type);
 
 	FillHandoverSchemaObject(ComponentObject, Object, Info, Changes, true);
 
+	if (SerializeTrace.IsActive())
+	{
+		SerializeTrace.SetBytes(Schema_GetWriteBufferLength(ComponentObject));
+	}
+
 	return ComponentData;
 }
 
@@ -427,6 +442,8 @@ TArray<Worker_ComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 
 Worker_ComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool& bWroteSomething)
 {
+	FSpatialTraceScope SerializeTrace(ESpatialTraceEvent::SerializeComponentUpdate, SpatialConstants::INVALID_ENTITY_ID, ComponentId);
+
 	Worker_ComponentUpdate ComponentUpdate = {};
 
 	ComponentUpdate.component_id = ComponentId;
@@ -446,12 +463,18 @@ Worker_ComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentI
 	{
 		Schema_DestroyComponentUpdate(ComponentUpdate.schema_type);
 	}
+	else if (SerializeTrace.IsActive())
+	{
+		SerializeTrace.SetBytes(Schema_GetWriteBufferLength(ComponentObject));
+	}
 
 	return ComponentUpdate;
 }
 
 Worker_ComponentUpdate ComponentFactory::CreateHandoverComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes, bool& bWroteSomething)
 {
+	FSpatialTraceScope SerializeTrace(ESpatialTraceEvent::SerializeComponentUpdate, SpatialConstants::INVALID_ENTITY_ID, ComponentId);
+
 	Worker_ComponentUpdate ComponentUpdate = {};
 
 	ComponentUpdate.component_id = ComponentId;
@@ -471,6 +494,10 @@ Worker_ComponentUpdate ComponentFactory::CreateHandoverComponentUpdate(Worker_Co
 	{
 		Schema_DestroyComponentUpdate(ComponentUpdate.schema_type);
 	}
+	else if (SerializeTrace.IsActive())
+	{
+		SerializeTrace.SetBytes(Schema_GetWriteBufferLength(ComponentObject));
+	}
 
 	return ComponentUpdate;
 }
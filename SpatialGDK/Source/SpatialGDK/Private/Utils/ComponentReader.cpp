@@ -96,23 +96,24 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject*
 	TUniquePtr<FRepState>& RepState = Replicator.RepState;
 #endif
 	TArray<FRepLayoutCmd>& Cmds = Replicator.RepLayout->Cmds;
-	TArray<FHandleToCmdIndex>& BaseHandleToCmdIndex = Replicator.RepLayout->BaseHandleToCmdIndex;
 	TArray<FRepParentCmd>& Parents = Replicator.RepLayout->Parents;
 
+	const TSharedRef<const FRepApplyPlan> ApplyPlan = ClassInfoManager->GetOrCreateRepApplyPlan(Object->GetClass(), *Replicator.RepLayout);
+
 	bool bIsAuthServer = Channel->IsAuthoritativeServer();
 	bool bAutonomousProxy = Channel->IsClientAutonomousProxy();
 	bool bIsClient = NetDriver->GetNetMode() == NM_Client;
 
-	FSpatialConditionMapFilter ConditionMap(Channel, bIsClient);
+	const FSpatialConditionMapFilter& ConditionMap = Channel->GetConditionMapFilter(bIsClient);
 
 	TArray<UProperty*> RepNotifies;
 
 	for (uint32 FieldId : UpdatedIds)
 	{
 		// FieldId is the same as rep handle
-		check(FieldId > 0 && (int)FieldId - 1 < BaseHandleToCmdIndex.Num());
-		int32 CmdIndex = BaseHandleToCmdIndex[FieldId - 1].CmdIndex;
-		const FRepLayoutCmd& Cmd = Cmds[CmdIndex];
+		check(FieldId > 0 && (int)FieldId - 1 < ApplyPlan->Fields.Num());
+		const FRepFieldApplyHandler& Field = ApplyPlan->Fields[FieldId - 1];
+		const FRepLayoutCmd& Cmd = Cmds[Field.CmdIndex];
 		const FRepParentCmd& Parent = Parents[Cmd.ParentIndex];
 #if ENGINE_MINOR_VERSION <= 20
 		int32 ShadowOffset = 0;
@@ -126,26 +127,26 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject*
 
 			uint8* Data = (uint8*)Object + SwappedCmd.Offset;
 
-			if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
+			if (Field.ArrayProperty != nullptr)
 			{
-				UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Cmd.Property);
-
 				// Check if this is a FastArraySerializer array and if so, call our custom delta serialization
-				if (UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty))
+				if (Field.NetDeltaStruct != nullptr)
 				{
-					TArray<uint8> ValueData = GetBytesFromSchema(ComponentObject, FieldId);
-					int64 CountBits = ValueData.Num() * 8;
+					// No temporary array between the schema buffer and the reader, although FBitReader still copies the payload into its own buffer.
+					uint32 PayloadSize = Schema_IndexBytesLength(ComponentObject, FieldId, 0);
+					uint8* Payload = const_cast<uint8*>(Schema_IndexBytes(ComponentObject, FieldId, 0));
+					int64 CountBits = PayloadSize * 8;
 					TSet<FUnrealObjectRef> NewUnresolvedRefs;
-					FSpatialNetBitReader ValueDataReader(PackageMap, ValueData.GetData(), CountBits, NewUnresolvedRefs);
+					FSpatialNetBitReader ValueDataReader(PackageMap, Payload, CountBits, NewUnresolvedRefs);
 
-					if (ValueData.Num() > 0)
+					if (PayloadSize > 0)
 					{
-						FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct);
+						FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, Object, Parent.ArrayIndex, Parent.Property, Field.NetDeltaStruct);
 					}
 
 					if (NewUnresolvedRefs.Num() > 0)
 					{
-						RootObjectReferencesMap.Add(SwappedCmd.Offset, FObjectReferences(ValueData, CountBits, NewUnresolvedRefs, ShadowOffset, Cmd.ParentIndex, ArrayProperty, /* bFastArrayProp */ true));
+						RootObjectReferencesMap.Add(SwappedCmd.Offset, FObjectReferences(TArray<uint8>(Payload, PayloadSize), CountBits, NewUnresolvedRefs, ShadowOffset, Cmd.ParentIndex, Field.ArrayProperty, /* bFastArrayProp */ true));
 						UnresolvedRefs.Append(NewUnresolvedRefs);
 					}
 					else if (RootObjectReferencesMap.Find(FieldId))
@@ -155,19 +156,19 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject*
 				}
 				else
 				{
-					ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, ArrayProperty, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
+					ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, Field, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
 				}
 			}
 			else
 			{
-				ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, Cmd.Property, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
+				ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, Field.Element, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
 			}
 
-			if (Cmd.Property->GetFName() == NAME_RemoteRole)
+			if (Field.bIsRemoteRole)
 			{
 				// Downgrade role from AutonomousProxy to SimulatedProxy if we aren't authoritative over
 				// the client RPCs component.
-				UByteProperty* ByteProperty = Cast<UByteProperty>(Cmd.Property);
+				UByteProperty* ByteProperty = static_cast<UByteProperty*>(Cmd.Property);
 				if (!bIsAuthServer && !bAutonomousProxy && ByteProperty->GetPropertyValue(Data) == ROLE_AutonomousProxy)
 				{
 					ByteProperty->SetPropertyValue(Data, ROLE_SimulatedProxy);
@@ -222,88 +223,85 @@ void ComponentReader::ApplyHandoverSchemaObject(Schema_Object* ComponentObject,
 
 		uint8* Data = (uint8*)Object + PropertyInfo.Offset;
 
-		if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(PropertyInfo.Property))
+		if (PropertyInfo.Handler.ArrayProperty != nullptr)
 		{
-			ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, ArrayProperty, Data, PropertyInfo.Offset, -1, -1);
+			ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, PropertyInfo.Handler, Data, PropertyInfo.Offset, -1, -1);
 		}
 		else
 		{
-			ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, PropertyInfo.Property, Data, PropertyInfo.Offset, -1, -1);
+			ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, PropertyInfo.Handler.Element, Data, PropertyInfo.Offset, -1, -1);
 		}
 	}
 
 	Channel->PostReceiveSpatialUpdate(Object, TArray<UProperty*>());
 }
 
-void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, UProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
+void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, const FPropertyApplyHandler& Handler, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
 {
-	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	UProperty* Property = Handler.Property;
+
+	switch (Handler.Kind)
 	{
-		TArray<uint8> ValueData = IndexBytesFromSchema(Object, FieldId, Index);
+	case EPropertyApplyKind::Struct:
+	{
+		// No temporary array between the schema buffer and the reader, although FBitReader still copies the payload into its own buffer.
+		uint32 PayloadSize = Schema_IndexBytesLength(Object, FieldId, Index);
+		uint8* Payload = const_cast<uint8*>(Schema_IndexBytes(Object, FieldId, Index));
 		// A bit hacky, we should probably include the number of bits with the data instead.
-		int64 CountBits = ValueData.Num() * 8;
+		int64 CountBits = PayloadSize * 8;
 		TSet<FUnrealObjectRef> NewUnresolvedRefs;
-		FSpatialNetBitReader ValueDataReader(PackageMap, ValueData.GetData(), CountBits, NewUnresolvedRefs);
+		FSpatialNetBitReader ValueDataReader(PackageMap, Payload, CountBits, NewUnresolvedRefs);
 		bool bHasUnmapped = false;
 
-		ReadStructProperty(ValueDataReader, StructProperty, NetDriver, Data, bHasUnmapped);
+		ReadStructProperty(ValueDataReader, static_cast<UStructProperty*>(Property), NetDriver, Data, bHasUnmapped);
 
 		if (bHasUnmapped)
 		{
-			InObjectReferencesMap.Add(Offset, FObjectReferences(ValueData, CountBits, NewUnresolvedRefs, ShadowOffset, ParentIndex, Property));
+			InObjectReferencesMap.Add(Offset, FObjectReferences(TArray<uint8>(Payload, PayloadSize), CountBits, NewUnresolvedRefs, ShadowOffset, ParentIndex, Property));
 			UnresolvedRefs.Append(NewUnresolvedRefs);
 		}
 		else if (InObjectReferencesMap.Find(Offset))
 		{
 			InObjectReferencesMap.Remove(Offset);
 		}
-	}
-	else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
-	{
-		BoolProperty->SetPropertyValue(Data, Schema_IndexBool(Object, FieldId, Index) != 0);
-	}
-	else if (UFloatProperty* FloatProperty = Cast<UFloatProperty>(Property))
-	{
-		FloatProperty->SetPropertyValue(Data, Schema_IndexFloat(Object, FieldId, Index));
-	}
-	else if (UDoubleProperty* DoubleProperty = Cast<UDoubleProperty>(Property))
-	{
-		DoubleProperty->SetPropertyValue(Data, Schema_IndexDouble(Object, FieldId, Index));
-	}
-	else if (UInt8Property* Int8Property = Cast<UInt8Property>(Property))
-	{
-		Int8Property->SetPropertyValue(Data, (int8)Schema_IndexInt32(Object, FieldId, Index));
-	}
-	else if (UInt16Property* Int16Property = Cast<UInt16Property>(Property))
-	{
-		Int16Property->SetPropertyValue(Data, (int16)Schema_IndexInt32(Object, FieldId, Index));
-	}
-	else if (UIntProperty* IntProperty = Cast<UIntProperty>(Property))
-	{
-		IntProperty->SetPropertyValue(Data, Schema_IndexInt32(Object, FieldId, Index));
-	}
-	else if (UInt64Property* Int64Property = Cast<UInt64Property>(Property))
-	{
-		Int64Property->SetPropertyValue(Data, Schema_IndexInt64(Object, FieldId, Index));
-	}
-	else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
-	{
-		ByteProperty->SetPropertyValue(Data, (uint8)Schema_IndexUint32(Object, FieldId, Index));
-	}
-	else if (UUInt16Property* UInt16Property = Cast<UUInt16Property>(Property))
-	{
-		UInt16Property->SetPropertyValue(Data, (uint16)Schema_IndexUint32(Object, FieldId, Index));
-	}
-	else if (UUInt32Property* UInt32Property = Cast<UUInt32Property>(Property))
-	{
-		UInt32Property->SetPropertyValue(Data, Schema_IndexUint32(Object, FieldId, Index));
-	}
-	else if (UUInt64Property* UInt64Property = Cast<UUInt64Property>(Property))
-	{
-		UInt64Property->SetPropertyValue(Data, Schema_IndexUint64(Object, FieldId, Index));
-	}
-	else if (UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property))
-	{
+		break;
+	}
+	case EPropertyApplyKind::Bool:
+		static_cast<UBoolProperty*>(Property)->SetPropertyValue(Data, Schema_IndexBool(Object, FieldId, Index) != 0);
+		break;
+	case EPropertyApplyKind::Float:
+		static_cast<UFloatProperty*>(Property)->SetPropertyValue(Data, Schema_IndexFloat(Object, FieldId, Index));
+		break;
+	case EPropertyApplyKind::Double:
+		static_cast<UDoubleProperty*>(Property)->SetPropertyValue(Data, Schema_IndexDouble(Object, FieldId, Index));
+		break;
+	case EPropertyApplyKind::Int8:
+		static_cast<UInt8Property*>(Property)->SetPropertyValue(Data, (int8)Schema_IndexInt32(Object, FieldId, Index));
+		break;
+	case EPropertyApplyKind::Int16:
+		static_cast<UInt16Property*>(Property)->SetPropertyValue(Data, (int16)Schema_IndexInt32(Object, FieldId, Index));
+		break;
+	case EPropertyApplyKind::Int32:
+		static_cast<UIntProperty*>(Property)->SetPropertyValue(Data, Schema_IndexInt32(Object, FieldId, Index));
+		break;
+	case EPropertyApplyKind::Int64:
+		static_cast<UInt64Property*>(Property)->SetPropertyValue(Data, Schema_IndexInt64(Object, FieldId, Index));
+		break;
+	case EPropertyApplyKind::Byte:
+		static_cast<UByteProperty*>(Property)->SetPropertyValue(Data, (uint8)Schema_IndexUint32(Object, FieldId, Index));
+		break;
+	case EPropertyApplyKind::UInt16:
+		static_cast<UUInt16Property*>(Property)->SetPropertyValue(Data, (uint16)Schema_IndexUint32(Object, FieldId, Index));
+		break;
+	case EPropertyApplyKind::UInt32:
+		static_cast<UUInt32Property*>(Property)->SetPropertyValue(Data, Schema_IndexUint32(Object, FieldId, Index));
+		break;
+	case EPropertyApplyKind::UInt64:
+		static_cast<UUInt64Property*>(Property)->SetPropertyValue(Data, Schema_IndexUint64(Object, FieldId, Index));
+		break;
+	case EPropertyApplyKind::Object:
+	{
+		UObjectPropertyBase* ObjectProperty = static_cast<UObjectPropertyBase*>(Property);
 		FUnrealObjectRef ObjectRef = IndexObjectRefFromSchema(Object, FieldId, Index);
 		check(ObjectRef != FUnrealObjectRef::UNRESOLVED_OBJECT_REF);
 		bool bUnresolved = false;
@@ -347,38 +345,30 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 		{
 			InObjectReferencesMap.Remove(Offset);
 		}
-	}
-	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
-	{
-		NameProperty->SetPropertyValue(Data, FName(*IndexStringFromSchema(Object, FieldId, Index)));
-	}
-	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
-	{
-		StrProperty->SetPropertyValue(Data, IndexStringFromSchema(Object, FieldId, Index));
-	}
-	else if (UTextProperty* TextProperty = Cast<UTextProperty>(Property))
-	{
-		TextProperty->SetPropertyValue(Data, FText::FromString(IndexStringFromSchema(Object, FieldId, Index)));
-	}
-	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
-	{
-		if (EnumProperty->ElementSize < 4)
-		{
-			EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(Data, (uint64)Schema_IndexUint32(Object, FieldId, Index));
-		}
-		else
-		{
-			ApplyProperty(Object, FieldId, InObjectReferencesMap, Index, EnumProperty->GetUnderlyingProperty(), Data, Offset, ShadowOffset, ParentIndex);
-		}
-	}
-	else
-	{
+		break;
+	}
+	case EPropertyApplyKind::Name:
+		static_cast<UNameProperty*>(Property)->SetPropertyValue(Data, FName(*IndexStringFromSchema(Object, FieldId, Index)));
+		break;
+	case EPropertyApplyKind::Str:
+		static_cast<UStrProperty*>(Property)->SetPropertyValue(Data, IndexStringFromSchema(Object, FieldId, Index));
+		break;
+	case EPropertyApplyKind::Text:
+		static_cast<UTextProperty*>(Property)->SetPropertyValue(Data, FText::FromString(IndexStringFromSchema(Object, FieldId, Index)));
+		break;
+	case EPropertyApplyKind::SmallEnum:
+		static_cast<UNumericProperty*>(Property)->SetIntPropertyValue(Data, (uint64)Schema_IndexUint32(Object, FieldId, Index));
+		break;
+	default:
 		checkf(false, TEXT("Tried to read unknown property in field %d"), FieldId);
+		break;
 	}
 }
 
-void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, UArrayProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
+void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, const FFieldApplyHandler& Handler, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
 {
+	UArrayProperty* Property = Handler.ArrayProperty;
+
 	FObjectReferencesMap* ArrayObjectReferences;
 	bool bNewArrayMap = false;
 	if (FObjectReferences* ExistingEntry = InObjectReferencesMap.Find(Offset))
@@ -395,13 +385,13 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 
 	FScriptArrayHelper ArrayHelper(Property, Data);
 
-	int Count = GetPropertyCount(Object, FieldId, Property->Inner);
+	int Count = GetPropertyCount(Object, FieldId, Handler.Element.Kind);
 	ArrayHelper.Resize(Count);
 
 	for (int i = 0; i < Count; i++)
 	{
 		int32 ElementOffset = i * Property->Inner->ElementSize;
-		ApplyProperty(Object, FieldId, *ArrayObjectReferences, i, Property->Inner, ArrayHelper.GetRawPtr(i), ElementOffset, ElementOffset, ParentIndex);
+		ApplyProperty(Object, FieldId, *ArrayObjectReferences, i, Handler.Element, ArrayHelper.GetRawPtr(i), ElementOffset, ElementOffset, ParentIndex);
 	}
 
 	if (ArrayObjectReferences->Num() > 0)
@@ -425,89 +415,37 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 	}
 }
 
-uint32 ComponentReader::GetPropertyCount(const Schema_Object* Object, Schema_FieldId FieldId, UProperty* Property)
+uint32 ComponentReader::GetPropertyCount(const Schema_Object* Object, Schema_FieldId FieldId, EPropertyApplyKind Kind)
 {
-	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	switch (Kind)
 	{
+	case EPropertyApplyKind::Struct:
+	case EPropertyApplyKind::Name:
+	case EPropertyApplyKind::Str:
+	case EPropertyApplyKind::Text:
 		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
-	{
+	case EPropertyApplyKind::Bool:
 		return Schema_GetBoolCount(Object, FieldId);
-	}
-	else if (UFloatProperty* FloatProperty = Cast<UFloatProperty>(Property))
-	{
+	case EPropertyApplyKind::Float:
 		return Schema_GetFloatCount(Object, FieldId);
-	}
-	else if (UDoubleProperty* DoubleProperty = Cast<UDoubleProperty>(Property))
-	{
+	case EPropertyApplyKind::Double:
 		return Schema_GetDoubleCount(Object, FieldId);
-	}
-	else if (UInt8Property* Int8Property = Cast<UInt8Property>(Property))
-	{
-		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (UInt16Property* Int16Property = Cast<UInt16Property>(Property))
-	{
-		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (UIntProperty* IntProperty = Cast<UIntProperty>(Property))
-	{
+	case EPropertyApplyKind::Int8:
+	case EPropertyApplyKind::Int16:
+	case EPropertyApplyKind::Int32:
 		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (UInt64Property* Int64Property = Cast<UInt64Property>(Property))
-	{
+	case EPropertyApplyKind::Int64:
 		return Schema_GetInt64Count(Object, FieldId);
-	}
-	else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
-	{
-		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (UUInt16Property* UInt16Property = Cast<UUInt16Property>(Property))
-	{
-		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (UUInt32Property* UInt32Property = Cast<UUInt32Property>(Property))
-	{
+	case EPropertyApplyKind::Byte:
+	case EPropertyApplyKind::UInt16:
+	case EPropertyApplyKind::UInt32:
+	case EPropertyApplyKind::SmallEnum:
 		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (UUInt64Property* UInt64Property = Cast<UUInt64Property>(Property))
-	{
+	case EPropertyApplyKind::UInt64:
 		return Schema_GetUint64Count(Object, FieldId);
-	}
-	else if (UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property))
-	{
+	case EPropertyApplyKind::Object:
 		return Schema_GetObjectCount(Object, FieldId);
-	}
-	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UTextProperty* TextProperty = Cast<UTextProperty>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
-	{
-		return GetPropertyCount(Object, FieldId, ArrayProperty->Inner);
-	}
-	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
-	{
-		if (EnumProperty->ElementSize < 4)
-		{
-			return Schema_GetUint32Count(Object, FieldId);
-		}
-		else
-		{
-			return GetPropertyCount(Object, FieldId, EnumProperty->GetUnderlyingProperty());
-		}
-	}
-	else
-	{
+	default:
 		checkf(false, TEXT("Tried to get count of unknown property in field %d"), FieldId);
 		return 0;
 	}
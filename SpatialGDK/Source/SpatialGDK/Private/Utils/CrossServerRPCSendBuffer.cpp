@@ -0,0 +1,240 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/CrossServerRPCSendBuffer.h"
+
+DEFINE_LOG_CATEGORY(LogCrossServerRPCs);
+
+using namespace SpatialGDK;
+
+FCrossServerRPCSendBuffer::~FCrossServerRPCSendBuffer()
+{
+	if (BatchObject != nullptr)
+	{
+		Schema_DestroyComponentUpdate(BatchUpdate.schema_type);
+	}
+}
+
+bool FCrossServerRPCSendBuffer::AddRPC(const FUnrealObjectRef& TargetObjectRef, const RPCPayload& Payload, bool bReliable)
+{
+	if (BatchObject == nullptr && !OpenBatch())
+	{
+		return false;
+	}
+
+	WriteRPC(FSentRPC{ TargetObjectRef, Payload, bReliable, 0 });
+	return true;
+}
+
+bool FCrossServerRPCSendBuffer::OpenBatch()
+{
+	const uint64 BatchId = LastSentBatchId + 1;
+
+	// The slot for this batch still holds the batch sent RING_BUFFER_SIZE batches ago, which must have been resolved.
+	if (BatchId > SpatialConstants::CROSS_SERVER_RPC_RING_BUFFER_SIZE && LastResolvedBatchId < BatchId - SpatialConstants::CROSS_SERVER_RPC_RING_BUFFER_SIZE)
+	{
+		return false;
+	}
+
+	BatchUpdate = {};
+	BatchUpdate.component_id = SpatialConstants::CROSS_SERVER_RPC_SENDER_COMPONENT_ID;
+	BatchUpdate.schema_type = Schema_CreateComponentUpdate(SpatialConstants::CROSS_SERVER_RPC_SENDER_COMPONENT_ID);
+	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(BatchUpdate.schema_type);
+	BatchObject = Schema_AddObject(ComponentObject, CrossServerRPCSender::GetSlotFieldId(BatchId));
+
+	check(GetSentBatch(BatchId).RPCs.Num() == 0);
+	return true;
+}
+
+void FCrossServerRPCSendBuffer::WriteRPC(FSentRPC&& RPC)
+{
+	Schema_Object* RPCObject = Schema_AddObject(BatchObject, SpatialConstants::CROSS_SERVER_RPC_BATCH_RPCS_ID);
+	RPCPayload::WriteToSchemaObject(RPCObject, RPC.TargetObjectRef.Offset, RPC.Payload.Index, RPC.Payload.PayloadData.GetData(), RPC.Payload.PayloadData.Num());
+	Schema_AddEntityId(RPCObject, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID, RPC.TargetObjectRef.Entity);
+
+	GetSentBatch(LastSentBatchId + 1).RPCs.Add(MoveTemp(RPC));
+}
+
+bool FCrossServerRPCSendBuffer::FlushBatch(Worker_ComponentUpdate& OutUpdate)
+{
+	if (BatchObject == nullptr)
+	{
+		return false;
+	}
+
+	LastSentBatchId++;
+
+	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(BatchUpdate.schema_type);
+	Schema_AddUint64(ComponentObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_LAST_SENT_BATCH_ID, LastSentBatchId);
+	Schema_AddUint64(ComponentObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_LAST_RESOLVED_BATCH_ID, LastResolvedBatchId);
+
+	OutUpdate = BatchUpdate;
+	BatchUpdate = {};
+	BatchObject = nullptr;
+
+	return true;
+}
+
+void FCrossServerRPCSendBuffer::SetReceiverAck(Worker_EntityId ReceiverWorkerEntityId, const CrossServerRPCSenderAck& Ack)
+{
+	ReceiverAcks.Add(ReceiverWorkerEntityId, Ack);
+}
+
+void FCrossServerRPCSendBuffer::RemoveReceiver(Worker_EntityId ReceiverWorkerEntityId)
+{
+	ReceiverAcks.Remove(ReceiverWorkerEntityId);
+}
+
+int32 FCrossServerRPCSendBuffer::ResolveAcknowledgedBatches()
+{
+	int32 NumDropped = 0;
+
+	while (LastResolvedBatchId < LastSentBatchId)
+	{
+		const uint64 BatchId = LastResolvedBatchId + 1;
+
+		for (const auto& Pair : ReceiverAcks)
+		{
+			if (Pair.Value.LastAckedBatchId < BatchId)
+			{
+				return NumDropped;
+			}
+		}
+
+		// Take the batch out of its slot first, the slot may be the one the RPCs are written into again.
+		FSentBatch& Batch = GetSentBatch(BatchId);
+		TArray<FSentRPC> RPCs = MoveTemp(Batch.RPCs);
+		CrossServerRPCBatchAck LocalAck = MoveTemp(Batch.LocalAck);
+		Batch.RPCs.Reset();
+		Batch.LocalAck = CrossServerRPCBatchAck();
+
+		LastResolvedBatchId = BatchId;
+
+		TArray<const CrossServerRPCBatchAck*, TInlineAllocator<8>> BatchAcks;
+		for (const auto& Pair : ReceiverAcks)
+		{
+			if (const CrossServerRPCBatchAck* BatchAck = Pair.Value.FindBatchAck(BatchId))
+			{
+				BatchAcks.Add(BatchAck);
+			}
+		}
+
+		for (int32 RPCIndex = 0; RPCIndex < RPCs.Num(); RPCIndex++)
+		{
+			FSentRPC& RPC = RPCs[RPCIndex];
+			if (!RPC.bReliable || LocalAck.IsExecuted(RPCIndex)
+				|| BatchAcks.ContainsByPredicate([RPCIndex](const CrossServerRPCBatchAck* BatchAck) { return BatchAck->IsExecuted(RPCIndex); }))
+			{
+				continue;
+			}
+
+			if (RPC.Resends >= SpatialConstants::CROSS_SERVER_RPC_MAX_RESENDS)
+			{
+				UE_LOG(LogCrossServerRPCs, Warning, TEXT("Giving up on reliable cross-server RPC %u to entity %lld after %u resends, no server executed it."),
+					RPC.Payload.Index, RPC.TargetObjectRef.Entity, RPC.Resends);
+				NumDropped++;
+				continue;
+			}
+
+			// Resolving this batch freed the slot the next batch needs, so this can't fail.
+			verify(BatchObject != nullptr || OpenBatch());
+			RPC.Resends++;
+			WriteRPC(MoveTemp(RPC));
+		}
+	}
+
+	return NumDropped;
+}
+
+int32 FCrossServerRPCSendBuffer::GetNumUnresolvedRPCs() const
+{
+	int32 NumRPCs = 0;
+	for (const FSentBatch& Batch : SentBatches)
+	{
+		NumRPCs += Batch.RPCs.Num();
+	}
+	return NumRPCs;
+}
+
+namespace SpatialGDK
+{
+
+bool StartCrossServerRPCSenderAck(Schema_Object* SenderComponentObject, CrossServerRPCSenderAck& OutAck)
+{
+	if (Schema_GetUint64Count(SenderComponentObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_LAST_SENT_BATCH_ID) == 0)
+	{
+		return false;
+	}
+
+	OutAck = CrossServerRPCSenderAck();
+	OutAck.LastAckedBatchId = Schema_GetUint64(SenderComponentObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_LAST_SENT_BATCH_ID);
+	return true;
+}
+
+bool ReadCrossServerRPCBatches(Worker_EntityId SenderWorkerEntityId, Schema_Object* SenderComponentObject, CrossServerRPCSenderAck& Ack,
+	TFunctionRef<bool(const FUnrealObjectRef&, RPCPayload&&)> ExecuteRPC)
+{
+	bool bAckChanged = false;
+
+	// The sender no longer needs to know what we executed from resolved batches.
+	if (Schema_GetUint64Count(SenderComponentObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_LAST_RESOLVED_BATCH_ID) > 0)
+	{
+		const uint64 LastResolvedBatchId = Schema_GetUint64(SenderComponentObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_LAST_RESOLVED_BATCH_ID);
+		bAckChanged |= Ack.BatchAcks.RemoveAll([LastResolvedBatchId](const CrossServerRPCBatchAck& BatchAck) { return BatchAck.BatchId <= LastResolvedBatchId; }) > 0;
+	}
+
+	if (Schema_GetUint64Count(SenderComponentObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_LAST_SENT_BATCH_ID) == 0)
+	{
+		return bAckChanged;
+	}
+
+	const uint64 LastSentBatchId = Schema_GetUint64(SenderComponentObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_LAST_SENT_BATCH_ID);
+	if (LastSentBatchId <= Ack.LastAckedBatchId)
+	{
+		return bAckChanged;
+	}
+
+	if (LastSentBatchId - Ack.LastAckedBatchId > SpatialConstants::CROSS_SERVER_RPC_RING_BUFFER_SIZE)
+	{
+		// Only happens if the sender overwrote batches before it saw our acknowledgements.
+		UE_LOG(LogCrossServerRPCs, Warning, TEXT("Missed cross-server RPC batches %llu to %llu from worker entity %lld."),
+			Ack.LastAckedBatchId + 1, LastSentBatchId - SpatialConstants::CROSS_SERVER_RPC_RING_BUFFER_SIZE, SenderWorkerEntityId);
+		Ack.LastAckedBatchId = LastSentBatchId - SpatialConstants::CROSS_SERVER_RPC_RING_BUFFER_SIZE;
+	}
+
+	for (uint64 BatchId = Ack.LastAckedBatchId + 1; BatchId <= LastSentBatchId; BatchId++)
+	{
+		const Schema_FieldId SlotFieldId = CrossServerRPCSender::GetSlotFieldId(BatchId);
+		if (Schema_GetObjectCount(SenderComponentObject, SlotFieldId) == 0)
+		{
+			UE_LOG(LogCrossServerRPCs, Warning, TEXT("Cross-server RPC batch %llu from worker entity %lld was not found in its ring buffer slot."), BatchId, SenderWorkerEntityId);
+			continue;
+		}
+
+		CrossServerRPCBatchAck BatchAck;
+		BatchAck.BatchId = BatchId;
+
+		Schema_Object* BatchObject = Schema_GetObject(SenderComponentObject, SlotFieldId);
+		const uint32 RPCCount = Schema_GetObjectCount(BatchObject, SpatialConstants::CROSS_SERVER_RPC_BATCH_RPCS_ID);
+		for (uint32 i = 0; i < RPCCount; i++)
+		{
+			Schema_Object* RPCObject = Schema_IndexObject(BatchObject, SpatialConstants::CROSS_SERVER_RPC_BATCH_RPCS_ID, i);
+			RPCPayload Payload(RPCObject);
+			const FUnrealObjectRef TargetObjectRef(Schema_GetEntityId(RPCObject, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID), Payload.Offset);
+
+			if (ExecuteRPC(TargetObjectRef, MoveTemp(Payload)))
+			{
+				BatchAck.SetExecuted(i);
+			}
+		}
+
+		if (BatchAck.ExecutedRPCs.Num() > 0)
+		{
+			Ack.BatchAcks.Add(MoveTemp(BatchAck));
+		}
+	}
+
+	Ack.LastAckedBatchId = LastSentBatchId;
+	return true;
+}
+
+} // namespace SpatialGDK
@@ -2,20 +2,19 @@
 
 #include "Utils/EntityPool.h"
 
-#include "TimerManager.h"
-
 #include "Interop/SpatialReceiver.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/TimingWheel.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialEntityPool);
 
 using namespace SpatialGDK;
 
-void UEntityPool::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager)
+void UEntityPool::Init(USpatialNetDriver* InNetDriver, FTimingWheel* InTimingWheel)
 {
 	NetDriver = InNetDriver;
 	Receiver = InNetDriver->Receiver;
-	TimerManager = InTimerManager;
+	TimingWheel = InTimingWheel;
 
 	ReserveEntityIDs(GetDefault<USpatialGDKSettings>()->EntityPoolInitialReservationCount);
 }
@@ -64,15 +63,15 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 
 		ReservedEntityIDRanges.Add(NewEntityRange);
 
-		FTimerHandle ExpirationTimer;
+		FTimingWheelHandle ExpirationTimer;
 		TWeakObjectPtr<UEntityPool> WeakThis(this);
-		TimerManager->SetTimer(ExpirationTimer, [WeakThis, ExpiringEntityRangeId = NewEntityRange.EntityRangeId]()
+		TimingWheel->SetTimer(ExpirationTimer, [WeakThis, ExpiringEntityRangeId = NewEntityRange.EntityRangeId]()
 		{
 			if (UEntityPool* Pool = WeakThis.Get())
 			{
 				Pool->OnEntityRangeExpired(ExpiringEntityRangeId);
 			}
-		}, SpatialConstants::ENTITY_RANGE_EXPIRATION_INTERVAL_SECONDS, false);
+		}, SpatialConstants::ENTITY_RANGE_EXPIRATION_INTERVAL_SECONDS);
 
 		bIsAwaitingResponse = false;
 		if (!bIsReady)
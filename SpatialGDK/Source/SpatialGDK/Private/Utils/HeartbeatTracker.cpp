@@ -0,0 +1,82 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/HeartbeatTracker.h"
+
+#include "EngineClasses/SpatialNetConnection.h"
+
+void FHeartbeatTracker::Add(Worker_EntityId PlayerControllerEntity, USpatialNetConnection* Connection, double Now)
+{
+	if (int32* ExistingIndex = EntityToIndex.Find(PlayerControllerEntity))
+	{
+		Connections[*ExistingIndex] = Connection;
+		LastSeenTimes[*ExistingIndex] = Now;
+		return;
+	}
+
+	EntityToIndex.Add(PlayerControllerEntity, Entities.Num());
+	Entities.Add(PlayerControllerEntity);
+	LastSeenTimes.Add(Now);
+	Connections.Add(Connection);
+}
+
+void FHeartbeatTracker::Remove(Worker_EntityId PlayerControllerEntity)
+{
+	if (const int32* Index = EntityToIndex.Find(PlayerControllerEntity))
+	{
+		RemoveAt(*Index);
+	}
+}
+
+USpatialNetConnection* FHeartbeatTracker::GetConnection(Worker_EntityId PlayerControllerEntity) const
+{
+	const int32* Index = EntityToIndex.Find(PlayerControllerEntity);
+	return Index != nullptr ? Connections[*Index].Get() : nullptr;
+}
+
+bool FHeartbeatTracker::RecordHeartbeat(Worker_EntityId PlayerControllerEntity, double Now)
+{
+	const int32* Index = EntityToIndex.Find(PlayerControllerEntity);
+	if (Index == nullptr)
+	{
+		return false;
+	}
+
+	LastSeenTimes[*Index] = Now;
+	return true;
+}
+
+void FHeartbeatTracker::RemoveTimedOutConnections(double Now, double TimeoutSeconds, TArray<USpatialNetConnection*>& OutTimedOutConnections)
+{
+	const double Deadline = Now - TimeoutSeconds;
+
+	// Iterate backwards, as removing swaps the last entry into the removed slot.
+	for (int32 Index = Entities.Num() - 1; Index >= 0; Index--)
+	{
+		if (LastSeenTimes[Index] >= Deadline && Connections[Index].IsValid())
+		{
+			continue;
+		}
+
+		if (USpatialNetConnection* Connection = Connections[Index].Get())
+		{
+			OutTimedOutConnections.Add(Connection);
+		}
+
+		RemoveAt(Index);
+	}
+}
+
+void FHeartbeatTracker::RemoveAt(int32 Index)
+{
+	EntityToIndex.Remove(Entities[Index]);
+
+	const int32 LastIndex = Entities.Num() - 1;
+	if (Index != LastIndex)
+	{
+		EntityToIndex[Entities[LastIndex]] = Index;
+	}
+
+	Entities.RemoveAtSwap(Index, 1, /* bAllowShrinking */ false);
+	LastSeenTimes.RemoveAtSwap(Index, 1, /* bAllowShrinking */ false);
+	Connections.RemoveAtSwap(Index, 1, /* bAllowShrinking */ false);
+}
@@ -20,6 +20,17 @@ DEFINE_LOG_CATEGORY(LogInterestFactory);
 namespace
 {
 static TMap<UClass*, float> ClientInterestDistancesSquared;
+static uint32 ClientInterestDistancesVersion = 0;
+
+// The checkout radius constraints only depend on the gathered interest distances and the class hierarchy,
+// so they're built once and shared by every player until either changes.
+struct FCheckoutRadiusConstraintTemplate
+{
+	uint32 ClientInterestDistancesVersion = 0;
+	uint32 ClassHierarchyIndexVersion = 0;
+	SpatialGDK::QueryConstraint Constraint;
+};
+static TMap<TWeakObjectPtr<const USpatialClassInfoManager>, FCheckoutRadiusConstraintTemplate> CheckoutRadiusConstraintTemplates;
 }
 
 namespace SpatialGDK
@@ -27,6 +38,7 @@ namespace SpatialGDK
 void GatherClientInterestDistances()
 {
 	ClientInterestDistancesSquared.Empty();
+	ClientInterestDistancesVersion++;
 
 	const AActor* DefaultActor = Cast<AActor>(AActor::StaticClass()->GetDefaultObject());
 	const float DefaultDistanceSquared = DefaultActor->NetCullDistanceSquared;
@@ -204,7 +216,10 @@ Interest InterestFactory::CreatePlayerOwnedActorInterest() const
 	ClientQuery.FullSnapshotResult = true;
 
 	ComponentInterest ClientComponentInterest;
-	ClientComponentInterest.Queries.Add(ClientQuery);
+	if (!AddInterestLODQueries(LevelConstraints, ClientComponentInterest.Queries))
+	{
+		ClientComponentInterest.Queries.Add(ClientQuery);
+	}
 
 	AddUserDefinedQueries(LevelConstraints, ClientComponentInterest.Queries);
 
@@ -240,6 +255,108 @@ void InterestFactory::AddUserDefinedQueries(const QueryConstraint& LevelConstrai
 	}
 }
 
+static void ScaleRelativeCylinderRadii(QueryConstraint& Constraint, float Scale)
+{
+	if (Constraint.RelativeCylinderConstraint.IsSet())
+	{
+		Constraint.RelativeCylinderConstraint->Radius *= Scale;
+	}
+
+	for (QueryConstraint& AndConstraint : Constraint.AndConstraint)
+	{
+		ScaleRelativeCylinderRadii(AndConstraint, Scale);
+	}
+
+	for (QueryConstraint& OrConstraint : Constraint.OrConstraint)
+	{
+		ScaleRelativeCylinderRadii(OrConstraint, Scale);
+	}
+}
+
+static QueryConstraint CombineWithLevelConstraints(const QueryConstraint& Constraint, const QueryConstraint& LevelConstraints)
+{
+	if (!LevelConstraints.IsValid())
+	{
+		return Constraint;
+	}
+
+	QueryConstraint CombinedConstraint;
+	CombinedConstraint.AndConstraint.Add(Constraint);
+	CombinedConstraint.AndConstraint.Add(LevelConstraints);
+	return CombinedConstraint;
+}
+
+bool InterestFactory::AddInterestLODQueries(const QueryConstraint& LevelConstraints, TArray<SpatialGDK::Query>& OutQueries) const
+{
+	const UActorInterestComponent* ActorInterest = GetActorInterestComponent();
+	if (ActorInterest == nullptr || !ActorInterest->bUseInterestLOD || !ActorInterest->bUseNetCullDistanceSquaredForCheckoutRadius)
+	{
+		return false;
+	}
+
+	const QueryConstraint CheckoutRadiusConstraint = CreateCheckoutRadiusConstraints();
+	if (!CheckoutRadiusConstraint.IsValid())
+	{
+		return false;
+	}
+
+	// Near tier: the same query as without LOD, but with every checkout radius scaled down.
+	QueryConstraint NearCheckoutRadiusConstraint = CheckoutRadiusConstraint;
+	ScaleRelativeCylinderRadii(NearCheckoutRadiusConstraint, ActorInterest->NearTierRadiusFraction);
+
+	QueryConstraint NearSystemConstraints;
+	NearSystemConstraints.OrConstraint.Add(NearCheckoutRadiusConstraint);
+
+	QueryConstraint AlwaysInterestedConstraint = CreateAlwaysInterestedConstraint();
+	if (AlwaysInterestedConstraint.IsValid())
+	{
+		NearSystemConstraints.OrConstraint.Add(AlwaysInterestedConstraint);
+	}
+
+	NearSystemConstraints.OrConstraint.Add(CreateAlwaysRelevantConstraint());
+
+	Query NearQuery;
+	NearQuery.Constraint = CombineWithLevelConstraints(NearSystemConstraints, LevelConstraints);
+	NearQuery.FullSnapshotResult = true;
+	OutQueries.Add(NearQuery);
+
+	// Far tier: the full checkout radius, but only the components needed to create the Actors plus opted in classes, at a lower rate.
+	Query FarQuery;
+	FarQuery.Constraint = CombineWithLevelConstraints(CheckoutRadiusConstraint, LevelConstraints);
+	FarQuery.ResultComponentId = {
+		SpatialConstants::ENTITY_ACL_COMPONENT_ID,
+		SpatialConstants::METADATA_COMPONENT_ID,
+		SpatialConstants::POSITION_COMPONENT_ID,
+		SpatialConstants::SPAWN_DATA_COMPONENT_ID,
+		SpatialConstants::UNREAL_METADATA_COMPONENT_ID
+	};
+
+	for (const TSubclassOf<AActor>& FarTierClass : ActorInterest->FarTierClasses)
+	{
+		if (FarTierClass != nullptr)
+		{
+			FarQuery.ResultComponentId.Append(NetDriver->ClassInfoManager->GetComponentIdsForClassHierarchy(*FarTierClass));
+		}
+	}
+
+	if (ActorInterest->FarTierFrequency > 0.0f)
+	{
+		FarQuery.Frequency = ActorInterest->FarTierFrequency;
+	}
+
+	OutQueries.Add(FarQuery);
+
+	return true;
+}
+
+const UActorInterestComponent* InterestFactory::GetActorInterestComponent() const
+{
+	// There is a check elsewhere to ensure that there is at most one ActorInterestQueryComponent.
+	TArray<UActorInterestComponent*> ActorInterestComponents;
+	Actor->GetComponents<UActorInterestComponent>(ActorInterestComponents);
+	return ActorInterestComponents.Num() == 1 ? ActorInterestComponents[0] : nullptr;
+}
+
 QueryConstraint InterestFactory::CreateSystemDefinedConstraints() const
 {
 	QueryConstraint CheckoutRadiusConstraint = CreateCheckoutRadiusConstraints();
@@ -269,20 +386,45 @@ QueryConstraint InterestFactory::CreateSystemDefinedConstraints() const
 QueryConstraint InterestFactory::CreateCheckoutRadiusConstraints() const
 {
 	// If the actor has a component to specify interest and that indicates that we shouldn't generate
-	// constraints based on NetCullDistanceSquared, abort. There is a check elsewhere to ensure that
-	// there is at most one ActorInterestQueryComponent.
-	TArray<UActorInterestComponent*> ActorInterestComponents;
-	Actor->GetComponents<UActorInterestComponent>(ActorInterestComponents);
-	if (ActorInterestComponents.Num() == 1)
+	// constraints based on NetCullDistanceSquared, abort.
+	const UActorInterestComponent* ActorInterest = GetActorInterestComponent();
+	if (ActorInterest != nullptr && !ActorInterest->bUseNetCullDistanceSquaredForCheckoutRadius)
+	{
+		return QueryConstraint{};
+	}
+
+	check(NetDriver && NetDriver->ClassInfoManager);
+	const TWeakObjectPtr<const USpatialClassInfoManager> ClassInfoManager(NetDriver->ClassInfoManager);
+
+	if (!CheckoutRadiusConstraintTemplates.Contains(ClassInfoManager))
 	{
-		const UActorInterestComponent* ActorInterest = ActorInterestComponents[0];
-		check(ActorInterest);
-		if (!ActorInterest->bUseNetCullDistanceSquaredForCheckoutRadius)
+		// Drop templates belonging to net drivers that have since been destroyed.
+		for (auto It = CheckoutRadiusConstraintTemplates.CreateIterator(); It; ++It)
 		{
-			return QueryConstraint{};
+			if (!It.Key().IsValid())
+			{
+				It.RemoveCurrent();
+			}
 		}
 	}
 
+	FCheckoutRadiusConstraintTemplate& Template = CheckoutRadiusConstraintTemplates.FindOrAdd(ClassInfoManager);
+	const uint32 ClassHierarchyIndexVersion = NetDriver->ClassInfoManager->GetClassHierarchyIndexVersion();
+
+	if (!Template.Constraint.IsValid()
+		|| Template.ClientInterestDistancesVersion != ClientInterestDistancesVersion
+		|| Template.ClassHierarchyIndexVersion != ClassHierarchyIndexVersion)
+	{
+		Template.Constraint = BuildCheckoutRadiusConstraintTemplate();
+		Template.ClientInterestDistancesVersion = ClientInterestDistancesVersion;
+		Template.ClassHierarchyIndexVersion = ClassHierarchyIndexVersion;
+	}
+
+	return Template.Constraint;
+}
+
+QueryConstraint InterestFactory::BuildCheckoutRadiusConstraintTemplate() const
+{
 	// Checkout Radius constraints are defined by the NetCullDistanceSquared property on actors.
 	//   - Checkout radius is a RelativeCylinder constraint on the player controller.
 	//   - NetCullDistanceSquared on AActor is used to define the default checkout radius with no other constraints.
@@ -357,20 +499,26 @@ QueryConstraint InterestFactory::CreateAlwaysInterestedConstraint() const
 
 QueryConstraint InterestFactory::CreateAlwaysRelevantConstraint() const
 {
-	QueryConstraint AlwaysRelevantConstraint;
-
-	Worker_ComponentId ComponentIds[] = {
-		SpatialConstants::SINGLETON_COMPONENT_ID,
-		SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID,
-		SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID
-	};
-
-	for (Worker_ComponentId ComponentId : ComponentIds)
+	// Identical for every actor, so only build it once.
+	static const QueryConstraint AlwaysRelevantConstraint = []()
 	{
 		QueryConstraint Constraint;
-		Constraint.ComponentConstraint = ComponentId;
-		AlwaysRelevantConstraint.OrConstraint.Add(Constraint);
-	}
+
+		Worker_ComponentId ComponentIds[] = {
+			SpatialConstants::SINGLETON_COMPONENT_ID,
+			SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID,
+			SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID
+		};
+
+		for (Worker_ComponentId ComponentId : ComponentIds)
+		{
+			QueryConstraint ComponentConstraint;
+			ComponentConstraint.ComponentConstraint = ComponentId;
+			Constraint.OrConstraint.Add(ComponentConstraint);
+		}
+
+		return Constraint;
+	}();
 
 	return AlwaysRelevantConstraint;
 }
@@ -0,0 +1,142 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/PropertyApplyPlan.h"
+
+#include "Net/RepLayout.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+#include "Utils/RepLayoutUtils.h"
+
+namespace SpatialGDK
+{
+
+FPropertyApplyHandler MakePropertyApplyHandler(UProperty* Property)
+{
+	FPropertyApplyHandler Handler;
+	Handler.Property = Property;
+
+	if (Property->IsA<UStructProperty>())
+	{
+		Handler.Kind = EPropertyApplyKind::Struct;
+	}
+	else if (Property->IsA<UBoolProperty>())
+	{
+		Handler.Kind = EPropertyApplyKind::Bool;
+	}
+	else if (Property->IsA<UFloatProperty>())
+	{
+		Handler.Kind = EPropertyApplyKind::Float;
+	}
+	else if (Property->IsA<UDoubleProperty>())
+	{
+		Handler.Kind = EPropertyApplyKind::Double;
+	}
+	else if (Property->IsA<UInt8Property>())
+	{
+		Handler.Kind = EPropertyApplyKind::Int8;
+	}
+	else if (Property->IsA<UInt16Property>())
+	{
+		Handler.Kind = EPropertyApplyKind::Int16;
+	}
+	else if (Property->IsA<UIntProperty>())
+	{
+		Handler.Kind = EPropertyApplyKind::Int32;
+	}
+	else if (Property->IsA<UInt64Property>())
+	{
+		Handler.Kind = EPropertyApplyKind::Int64;
+	}
+	else if (Property->IsA<UByteProperty>())
+	{
+		Handler.Kind = EPropertyApplyKind::Byte;
+	}
+	else if (Property->IsA<UUInt16Property>())
+	{
+		Handler.Kind = EPropertyApplyKind::UInt16;
+	}
+	else if (Property->IsA<UUInt32Property>())
+	{
+		Handler.Kind = EPropertyApplyKind::UInt32;
+	}
+	else if (Property->IsA<UUInt64Property>())
+	{
+		Handler.Kind = EPropertyApplyKind::UInt64;
+	}
+	else if (Property->IsA<UObjectPropertyBase>())
+	{
+		Handler.Kind = EPropertyApplyKind::Object;
+	}
+	else if (Property->IsA<UNameProperty>())
+	{
+		Handler.Kind = EPropertyApplyKind::Name;
+	}
+	else if (Property->IsA<UStrProperty>())
+	{
+		Handler.Kind = EPropertyApplyKind::Str;
+	}
+	else if (Property->IsA<UTextProperty>())
+	{
+		Handler.Kind = EPropertyApplyKind::Text;
+	}
+	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
+	{
+		if (EnumProperty->ElementSize < 4)
+		{
+			Handler.Kind = EPropertyApplyKind::SmallEnum;
+			Handler.Property = EnumProperty->GetUnderlyingProperty();
+		}
+		else
+		{
+			Handler = MakePropertyApplyHandler(EnumProperty->GetUnderlyingProperty());
+		}
+	}
+
+	return Handler;
+}
+
+FFieldApplyHandler MakeFieldApplyHandler(UProperty* Property)
+{
+	FFieldApplyHandler Handler;
+
+	if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
+	{
+		Handler.ArrayProperty = ArrayProperty;
+		Handler.Element = MakePropertyApplyHandler(ArrayProperty->Inner);
+	}
+	else
+	{
+		Handler.Element = MakePropertyApplyHandler(Property);
+	}
+
+	return Handler;
+}
+
+TSharedRef<const FRepApplyPlan> BuildRepApplyPlan(const FRepLayout& RepLayout)
+{
+	TSharedRef<FRepApplyPlan> Plan = MakeShared<FRepApplyPlan>();
+	Plan->Fields.Reserve(RepLayout.BaseHandleToCmdIndex.Num());
+
+	for (const FHandleToCmdIndex& HandleToCmdIndex : RepLayout.BaseHandleToCmdIndex)
+	{
+		const FRepLayoutCmd& Cmd = RepLayout.Cmds[HandleToCmdIndex.CmdIndex];
+
+		FRepFieldApplyHandler Field;
+		static_cast<FFieldApplyHandler&>(Field) = MakeFieldApplyHandler(Cmd.Property);
+		Field.CmdIndex = HandleToCmdIndex.CmdIndex;
+		Field.bIsRemoteRole = Cmd.Property->GetFName() == NAME_RemoteRole;
+
+		if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
+		{
+			Field.NetDeltaStruct = GetFastArraySerializerProperty(Field.ArrayProperty);
+		}
+
+		Plan->Fields.Add(Field);
+	}
+
+	return Plan;
+}
+
+} // namespace SpatialGDK
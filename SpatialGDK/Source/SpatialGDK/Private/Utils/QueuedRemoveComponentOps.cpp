@@ -0,0 +1,67 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/QueuedRemoveComponentOps.h"
+
+void FQueuedRemoveComponentOps::Add(const Worker_RemoveComponentOp& Op)
+{
+	FEntityOps* Entity = OpsByEntity.Find(Op.entity_id);
+	if (Entity == nullptr)
+	{
+		Entity = &OpsByEntity.Add(Op.entity_id);
+		Entity->PrevEntityId = LastEntityId;
+		Entity->NextEntityId = SpatialConstants::INVALID_ENTITY_ID;
+
+		if (LastEntityId != SpatialConstants::INVALID_ENTITY_ID)
+		{
+			OpsByEntity.FindChecked(LastEntityId).NextEntityId = Op.entity_id;
+		}
+		else
+		{
+			FirstEntityId = Op.entity_id;
+		}
+		LastEntityId = Op.entity_id;
+	}
+
+	Entity->Ops.Add(Op);
+	NumOps++;
+}
+
+void FQueuedRemoveComponentOps::RemoveEntity(Worker_EntityId EntityId)
+{
+	const FEntityOps* Entity = OpsByEntity.Find(EntityId);
+	if (Entity == nullptr)
+	{
+		return;
+	}
+
+	const Worker_EntityId PrevEntityId = Entity->PrevEntityId;
+	const Worker_EntityId NextEntityId = Entity->NextEntityId;
+	NumOps -= Entity->Ops.Num();
+	OpsByEntity.Remove(EntityId);
+
+	if (PrevEntityId != SpatialConstants::INVALID_ENTITY_ID)
+	{
+		OpsByEntity.FindChecked(PrevEntityId).NextEntityId = NextEntityId;
+	}
+	else
+	{
+		FirstEntityId = NextEntityId;
+	}
+
+	if (NextEntityId != SpatialConstants::INVALID_ENTITY_ID)
+	{
+		OpsByEntity.FindChecked(NextEntityId).PrevEntityId = PrevEntityId;
+	}
+	else
+	{
+		LastEntityId = PrevEntityId;
+	}
+}
+
+void FQueuedRemoveComponentOps::Reset()
+{
+	OpsByEntity.Reset();
+	FirstEntityId = SpatialConstants::INVALID_ENTITY_ID;
+	LastEntityId = SpatialConstants::INVALID_ENTITY_ID;
+	NumOps = 0;
+}
@@ -10,7 +10,7 @@ FPendingRPCParams::FPendingRPCParams(const FUnrealObjectRef& InTargetObjectRef,
 	: ReliableRPCIndex(InReliableRPCIndex)
 	, ObjectRef(InTargetObjectRef)
 	, Payload(MoveTemp(InPayload))
-	, QueuedTimestamp(FDateTime::Now())
+	, QueuedTimestamp(FPlatformTime::Seconds())
 {
 }
 
@@ -18,6 +18,7 @@ void FRPCContainer::QueueRPC(FPendingRPCParamsPtr Params, ESchemaComponentType T
 {
 	FArrayOfParams& ArrayOfParams = QueuedRPCs.FindOrAdd(Type).FindOrAdd(Params->ObjectRef.Entity);
 	ArrayOfParams.Push(MoveTemp(Params));
+	NumQueuedRPCs++;
 }
 
 void FRPCContainer::ProcessRPCs(const FProcessRPCDelegate& FunctionToApply, FArrayOfParams& RPCList)
@@ -36,6 +37,7 @@ void FRPCContainer::ProcessRPCs(const FProcessRPCDelegate& FunctionToApply, FArr
 		}
 	}
 	RPCList.RemoveAt(0, NumProcessedParams);
+	NumQueuedRPCs -= NumProcessedParams;
 }
 
 void FRPCContainer::ProcessRPCs(const FProcessRPCDelegate& FunctionToApply)
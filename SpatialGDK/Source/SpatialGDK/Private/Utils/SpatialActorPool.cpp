@@ -0,0 +1,95 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SpatialActorPool.h"
+
+#include "SpatialGDKSettings.h"
+
+void FSpatialActorPool::Init()
+{
+	for (const TPair<TSoftClassPtr<AActor>, int32>& PoolSize : GetDefault<USpatialGDKSettings>()->ActorPoolSizes)
+	{
+		if (PoolSize.Value > 0)
+		{
+			ClassPools.Add(PoolSize.Key).MaxSize = PoolSize.Value;
+		}
+	}
+}
+
+bool FSpatialActorPool::IsPooledClass(UClass* Class) const
+{
+	return ClassPools.Num() > 0 && ClassPools.Contains(TSoftClassPtr<AActor>(Class));
+}
+
+AActor* FSpatialActorPool::Acquire(UClass* Class, const FTransform& Transform)
+{
+	if (ClassPools.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	FClassPool* ClassPool = ClassPools.Find(TSoftClassPtr<AActor>(Class));
+	if (ClassPool == nullptr)
+	{
+		return nullptr;
+	}
+
+	while (ClassPool->Actors.Num() > 0)
+	{
+		const FPooledActor PooledActor = ClassPool->Actors.Pop(false);
+		NumPooledActors--;
+
+		// Pooled Actors can still be destroyed by gameplay code or a level unloading.
+		AActor* Actor = PooledActor.Actor.Get();
+		if (Actor == nullptr || Actor->IsPendingKillPending())
+		{
+			continue;
+		}
+
+		Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+		Actor->SetActorHiddenInGame(PooledActor.bWasHidden);
+		Actor->SetActorEnableCollision(PooledActor.bHadCollision);
+		Actor->SetActorTickEnabled(PooledActor.bWasTicking);
+
+		if (ISpatialPooledActor* PooledInterface = Cast<ISpatialPooledActor>(Actor))
+		{
+			PooledInterface->OnTakenFromPool();
+		}
+
+		return Actor;
+	}
+
+	return nullptr;
+}
+
+bool FSpatialActorPool::Release(AActor* Actor)
+{
+	if (ClassPools.Num() == 0)
+	{
+		return false;
+	}
+
+	FClassPool* ClassPool = ClassPools.Find(TSoftClassPtr<AActor>(Actor->GetClass()));
+	if (ClassPool == nullptr || ClassPool->Actors.Num() >= ClassPool->MaxSize)
+	{
+		return false;
+	}
+
+	FPooledActor PooledActor;
+	PooledActor.Actor = Actor;
+	PooledActor.bWasHidden = Actor->bHidden;
+	PooledActor.bHadCollision = Actor->GetActorEnableCollision();
+	PooledActor.bWasTicking = Actor->IsActorTickEnabled();
+	ClassPool->Actors.Add(PooledActor);
+	NumPooledActors++;
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	if (ISpatialPooledActor* PooledInterface = Cast<ISpatialPooledActor>(Actor))
+	{
+		PooledInterface->OnReturnedToPool();
+	}
+
+	return true;
+}
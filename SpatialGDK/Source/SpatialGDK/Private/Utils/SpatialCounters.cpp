@@ -0,0 +1,212 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SpatialCounters.h"
+
+#include "Interop/Connection/OutgoingMessages.h"
+
+namespace
+{
+const FSpatialCounterInfo COUNTER_INFOS[] =
+{
+	{ TEXT("Interop.Ops.AddEntityPerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.Ops.RemoveEntityPerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.Ops.AddComponentPerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.Ops.RemoveComponentPerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.Ops.AuthorityChangePerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.Ops.ComponentUpdatePerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.Ops.CommandRequestPerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.Ops.CommandResponsePerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.Ops.OtherPerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.ComponentUpdatesSentPerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.ComponentUpdateBytesPerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.ActorPool.HitsPerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.ActorPool.MissesPerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.ActorPool.Size"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.PlayerSpawner.LoginsPerSecond"), ESpatialCounterKind::Rate },
+	{ TEXT("Interop.PlayerSpawner.QueuedLogins"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.EntityCreationsInFlight"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.UnresolvedRefsPending"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.IncomingRPCsQueued"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.OutgoingRPCsQueued"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.EntitiesAwaitingClassLoad"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.EntitiesAwaitingSpawn"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.OutgoingQueue.Control.Depth"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.OutgoingQueue.Replication.Depth"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.OutgoingQueue.Bulk.Depth"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.OutgoingQueue.Diagnostics.Depth"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.OutgoingQueue.Control.MaxLatencyUs"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.OutgoingQueue.Replication.MaxLatencyUs"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.OutgoingQueue.Bulk.MaxLatencyUs"), ESpatialCounterKind::Gauge },
+	{ TEXT("Interop.OutgoingQueue.Diagnostics.MaxLatencyUs"), ESpatialCounterKind::Gauge },
+};
+static_assert(ARRAY_COUNT(COUNTER_INFOS) == static_cast<int32>(ESpatialCounter::Count), "Every ESpatialCounter needs an entry in COUNTER_INFOS");
+
+const char* COMPONENT_UPDATE_BYTES_KEY = "Interop.ComponentUpdateBytes";
+const char* REPLICATION_TIME_MS_KEY = "Interop.ReplicationTimeMs";
+
+// Smallest histogram bucket bounds, every following bucket doubles the bound.
+const double COMPONENT_UPDATE_BYTES_BASE_BOUND = 16.0;
+const double REPLICATION_TIME_MS_BASE_BOUND = 0.5;
+}
+
+void FSpatialMetricHistogram::Record(double Value, double BaseBound)
+{
+	int32 Bucket = 0;
+	if (Value > BaseBound)
+	{
+		// Bucket i holds values in (BaseBound * 2^(i-1), BaseBound * 2^i].
+		const uint32 Multiple = static_cast<uint32>(FMath::Min(FMath::CeilToDouble(Value / BaseBound), static_cast<double>(MAX_uint32)));
+		Bucket = FMath::Min(static_cast<int32>(FMath::CeilLogTwo(Multiple)), NUM_BUCKETS - 1);
+	}
+
+	Samples[Bucket]++;
+	NumSamples++;
+	Sum += Value;
+}
+
+void FSpatialMetricHistogram::AddTo(SpatialGDK::SpatialMetrics& OutMetrics, const std::string& Key, double BaseBound) const
+{
+	SpatialGDK::HistogramMetric Histogram;
+	Histogram.Key = Key;
+	Histogram.Sum = Sum;
+	Histogram.Buckets.SetNum(NUM_BUCKETS);
+
+	// SpatialOS buckets count every observation less than or equal to their upper bound.
+	uint32 CumulativeSamples = 0;
+	for (int32 i = 0; i < NUM_BUCKETS; i++)
+	{
+		CumulativeSamples += Samples[i];
+		Histogram.Buckets[i].UpperBound = i < NUM_BUCKETS - 1 ? BaseBound * (1 << i) : TNumericLimits<double>::Max();
+		Histogram.Buckets[i].Samples = CumulativeSamples;
+	}
+
+	OutMetrics.HistogramMetrics.Add(MoveTemp(Histogram));
+}
+
+void FSpatialMetricHistogram::Reset()
+{
+	FMemory::Memzero(Samples);
+	NumSamples = 0;
+	Sum = 0.0;
+}
+
+FSpatialCounters::FSpatialCounters()
+{
+	for (int32 i = 0; i < static_cast<int32>(ESpatialCounter::Count); i++)
+	{
+		Values[i] = 0;
+		Keys[i] = TCHAR_TO_UTF8(COUNTER_INFOS[i].Key);
+	}
+}
+
+const FSpatialCounterInfo& FSpatialCounters::GetCounterInfo(ESpatialCounter Counter)
+{
+	return COUNTER_INFOS[static_cast<int32>(Counter)];
+}
+
+ESpatialCounter FSpatialCounters::GetOpCounter(Worker_OpType OpType)
+{
+	switch (OpType)
+	{
+	case WORKER_OP_TYPE_ADD_ENTITY:
+		return ESpatialCounter::OpsAddEntity;
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+		return ESpatialCounter::OpsRemoveEntity;
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		return ESpatialCounter::OpsAddComponent;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		return ESpatialCounter::OpsRemoveComponent;
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		return ESpatialCounter::OpsAuthorityChange;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+		return ESpatialCounter::OpsComponentUpdate;
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+		return ESpatialCounter::OpsCommandRequest;
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+		return ESpatialCounter::OpsCommandResponse;
+	default:
+		return ESpatialCounter::OpsOther;
+	}
+}
+
+void FSpatialCounters::RecordComponentUpdateSent(Worker_ComponentId ComponentId)
+{
+	Increment(ESpatialCounter::ComponentUpdatesSent);
+	ComponentUpdateStats.FindOrAdd(ComponentId).Updates++;
+}
+
+void FSpatialCounters::RecordComponentUpdateBytesSent(Worker_ComponentId ComponentId, uint32 Bytes)
+{
+	Increment(ESpatialCounter::ComponentUpdateBytesSent, Bytes);
+	ComponentUpdateBytes.Record(Bytes, COMPONENT_UPDATE_BYTES_BASE_BOUND);
+	ComponentUpdateStats.FindOrAdd(ComponentId).Bytes += Bytes;
+}
+
+void FSpatialCounters::RecordReplicationTime(double Milliseconds)
+{
+	ReplicationTimeMs.Record(Milliseconds, REPLICATION_TIME_MS_BASE_BOUND);
+}
+
+void FSpatialCounters::AddTo(SpatialGDK::SpatialMetrics& OutMetrics, float SecondsSinceLastReport)
+{
+	for (int32 i = 0; i < static_cast<int32>(ESpatialCounter::Count); i++)
+	{
+		SpatialGDK::GaugeMetric Gauge;
+		Gauge.Key = Keys[i];
+
+		if (COUNTER_INFOS[i].Kind == ESpatialCounterKind::Rate)
+		{
+			Gauge.Value = SecondsSinceLastReport > 0.0f ? Values[i] / SecondsSinceLastReport : 0.0;
+			Values[i] = 0;
+		}
+		else
+		{
+			Gauge.Value = Values[i];
+		}
+
+		OutMetrics.GaugeMetrics.Add(Gauge);
+	}
+
+	ComponentUpdateBytes.AddTo(OutMetrics, COMPONENT_UPDATE_BYTES_KEY, COMPONENT_UPDATE_BYTES_BASE_BOUND);
+	ReplicationTimeMs.AddTo(OutMetrics, REPLICATION_TIME_MS_KEY, REPLICATION_TIME_MS_BASE_BOUND);
+
+	ComponentUpdateBytes.Reset();
+	ReplicationTimeMs.Reset();
+}
+
+void FSpatialCounters::Dump(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("SpatialOS counters (rates are totals since the last metrics report):"));
+	for (int32 i = 0; i < static_cast<int32>(ESpatialCounter::Count); i++)
+	{
+		const TCHAR* Key = COUNTER_INFOS[i].Key;
+		Ar.Logf(TEXT("  %-40s %lld"), Key, Values[i]);
+	}
+
+	Ar.Logf(TEXT("  %-40s %u samples, avg %.2f"), UTF8_TO_TCHAR(COMPONENT_UPDATE_BYTES_KEY), ComponentUpdateBytes.NumSamples,
+		ComponentUpdateBytes.NumSamples > 0 ? ComponentUpdateBytes.Sum / ComponentUpdateBytes.NumSamples : 0.0);
+	Ar.Logf(TEXT("  %-40s %u samples, avg %.3f"), UTF8_TO_TCHAR(REPLICATION_TIME_MS_KEY), ReplicationTimeMs.NumSamples,
+		ReplicationTimeMs.NumSamples > 0 ? ReplicationTimeMs.Sum / ReplicationTimeMs.NumSamples : 0.0);
+
+	if (ComponentUpdateStats.Num() > 0)
+	{
+		TArray<Worker_ComponentId> ComponentIds;
+		ComponentUpdateStats.GenerateKeyArray(ComponentIds);
+
+		// Show the components costing the most bandwidth at the top, or sending the most updates if sizes aren't measured.
+		ComponentIds.Sort([this](Worker_ComponentId A, Worker_ComponentId B)
+		{
+			const FComponentUpdateStats& StatsA = ComponentUpdateStats[A];
+			const FComponentUpdateStats& StatsB = ComponentUpdateStats[B];
+			return StatsA.Bytes != StatsB.Bytes ? StatsA.Bytes > StatsB.Bytes : StatsA.Updates > StatsB.Updates;
+		});
+
+		Ar.Logf(TEXT("Component updates sent per component:"));
+		Ar.Logf(TEXT("  Component ID |    Updates |        Bytes | Avg. bytes"));
+		for (Worker_ComponentId ComponentId : ComponentIds)
+		{
+			const FComponentUpdateStats& Stats = ComponentUpdateStats[ComponentId];
+			Ar.Logf(TEXT("  %12u | %10llu | %12llu | %10.2f"), ComponentId, Stats.Updates, Stats.Bytes, static_cast<double>(Stats.Bytes) / Stats.Updates);
+		}
+	}
+}
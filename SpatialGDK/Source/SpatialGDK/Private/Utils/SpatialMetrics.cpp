@@ -5,22 +5,42 @@
 #include "Engine/Engine.h"
 #include "EngineGlobals.h"
 #include "GameFramework/PlayerController.h"
+#include "Misc/App.h"
 
 #include "EngineClasses/SpatialNetConnection.h"
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/SpatialPlayerSpawner.h"
+#include "Interop/SpatialReceiver.h"
+#include "Interop/SpatialSender.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/RPCContainer.h"
 #include "Utils/SchemaUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialMetrics);
 
+namespace
+{
+// Smallest histogram bucket bounds, every following bucket doubles the bound.
+const double RPC_PAYLOAD_BYTES_BASE_BOUND = 16.0;
+const double RPC_QUEUE_DELAY_MS_BASE_BOUND = 1.0;
+const double RPC_SEND_LATENCY_US_BASE_BOUND = 10.0;
+}
+
 void USpatialMetrics::Init(USpatialNetDriver* InNetDriver)
 {
 	NetDriver = InNetDriver;
 	TimeBetweenMetricsReports = GetDefault<USpatialGDKSettings>()->MetricsReportRate;
 	FramesSinceLastReport = 0;
 	TimeOfLastReport = 0.0f;
+	AverageFPS = 0.0;
+	WorkerLoad = 0.0;
+
+	PackedRPCUpdatesSinceLastReport = 0;
+	PackedRPCsSinceLastReport = 0;
+	PackedRPCBytesSinceLastReport = 0;
+	UnpackedSingleRPCsSinceLastReport = 0;
 
 	bRPCTrackingEnabled = false;
 	RPCTrackingStartTime = 0.0f;
@@ -29,6 +49,7 @@ void USpatialMetrics::Init(USpatialNetDriver* InNetDriver)
 void USpatialMetrics::TickMetrics()
 {
 	FramesSinceLastReport++;
+	LoadEstimator.AddFrame(FApp::GetDeltaTime(), FApp::GetIdleTime());
 
 	TimeSinceLastReport = NetDriver->Time - TimeOfLastReport;
 
@@ -39,7 +60,9 @@ void USpatialMetrics::TickMetrics()
 	}
 
 	AverageFPS = FramesSinceLastReport / TimeSinceLastReport;
-	WorkerLoad = CalculateLoad();
+
+	const FWorkerLoadEstimator::FLoadBreakdown& LoadBreakdown = LoadEstimator.Update(1.0 / NetDriver->NetServerMaxTickRate, TimeSinceLastReport, NetDriver->Connection->ConsumeOpsThreadBusySeconds());
+	WorkerLoad = GetDefault<USpatialGDKSettings>()->bUseBusyTimeAsLoad ? LoadBreakdown.Load : CalculateLoad();
 
 	SpatialGDK::GaugeMetric DynamicFPSGauge;
 	DynamicFPSGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_DYNAMIC_FPS);
@@ -49,8 +72,53 @@ void USpatialMetrics::TickMetrics()
 	DynamicFPSMetrics.GaugeMetrics.Add(DynamicFPSGauge);
 	DynamicFPSMetrics.Load = WorkerLoad;
 
+	auto AddPerFrameGauge = [this, &DynamicFPSMetrics](const FString& Key, uint32 TotalSinceLastReport)
+	{
+		SpatialGDK::GaugeMetric Gauge;
+		Gauge.Key = TCHAR_TO_UTF8(*Key);
+		Gauge.Value = static_cast<double>(TotalSinceLastReport) / FramesSinceLastReport;
+		DynamicFPSMetrics.GaugeMetrics.Add(Gauge);
+	};
+
+	AddPerFrameGauge(SpatialConstants::SPATIALOS_METRICS_PACKED_RPC_UPDATES, PackedRPCUpdatesSinceLastReport);
+	AddPerFrameGauge(SpatialConstants::SPATIALOS_METRICS_PACKED_RPCS, PackedRPCsSinceLastReport);
+	AddPerFrameGauge(SpatialConstants::SPATIALOS_METRICS_PACKED_RPC_BYTES, PackedRPCBytesSinceLastReport);
+	AddPerFrameGauge(SpatialConstants::SPATIALOS_METRICS_UNPACKED_SINGLE_RPCS, UnpackedSingleRPCsSinceLastReport);
+
+	auto AddGauge = [&DynamicFPSMetrics](const FString& Key, double Value)
+	{
+		SpatialGDK::GaugeMetric Gauge;
+		Gauge.Key = TCHAR_TO_UTF8(*Key);
+		Gauge.Value = Value;
+		DynamicFPSMetrics.GaugeMetrics.Add(Gauge);
+	};
+
+	AddGauge(SpatialConstants::SPATIALOS_METRICS_LOAD_REPLICATION, LoadBreakdown.Replication);
+	AddGauge(SpatialConstants::SPATIALOS_METRICS_LOAD_RECEIVE, LoadBreakdown.Receive);
+	AddGauge(SpatialConstants::SPATIALOS_METRICS_LOAD_GAMEPLAY, LoadBreakdown.Gameplay);
+	AddGauge(SpatialConstants::SPATIALOS_METRICS_LOAD_GAME_THREAD, LoadBreakdown.GameThread);
+	AddGauge(SpatialConstants::SPATIALOS_METRICS_LOAD_OPS_THREAD, LoadBreakdown.OpsThread);
+	AddGauge(SpatialConstants::SPATIALOS_METRICS_LOAD_BUSY_TIME_ESTIMATE, LoadBreakdown.Load);
+
+	SpatialGDK::GaugeMetric ActiveTimersGauge;
+	ActiveTimersGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_ACTIVE_TIMERS);
+	ActiveTimersGauge.Value = NetDriver->GetTimingWheel().GetNumActiveTimers();
+	DynamicFPSMetrics.GaugeMetrics.Add(ActiveTimersGauge);
+
+	SampleCounters();
+	NetDriver->GetCounters().AddTo(DynamicFPSMetrics, TimeSinceLastReport);
+
+	if (GetDefault<USpatialGDKSettings>()->bEnableRPCMetrics)
+	{
+		AddRPCFunctionMetrics(DynamicFPSMetrics);
+	}
+
 	TimeOfLastReport = NetDriver->Time;
 	FramesSinceLastReport = 0;
+	PackedRPCUpdatesSinceLastReport = 0;
+	PackedRPCsSinceLastReport = 0;
+	PackedRPCBytesSinceLastReport = 0;
+	UnpackedSingleRPCsSinceLastReport = 0;
 
 	NetDriver->Connection->SendMetrics(DynamicFPSMetrics);
 }
@@ -70,6 +138,36 @@ double USpatialMetrics::CalculateLoad() const
 	return AverageFrameTime / TargetFrameTime;
 }
 
+void USpatialMetrics::SampleCounters()
+{
+	FSpatialCounters& Counters = NetDriver->GetCounters();
+	Counters.Set(ESpatialCounter::EntityCreationsInFlight, NetDriver->Receiver->GetNumPendingActorRequests());
+	Counters.Set(ESpatialCounter::UnresolvedRefsPending, NetDriver->Receiver->GetNumUnresolvedRefs());
+	Counters.Set(ESpatialCounter::IncomingRPCsQueued, NetDriver->Receiver->GetNumQueuedIncomingRPCs());
+	Counters.Set(ESpatialCounter::OutgoingRPCsQueued, NetDriver->Sender->GetNumQueuedOutgoingRPCs());
+	Counters.Set(ESpatialCounter::EntitiesAwaitingClassLoad, NetDriver->Receiver->GetNumEntitiesAwaitingClassLoad());
+	Counters.Set(ESpatialCounter::EntitiesAwaitingSpawn, NetDriver->Receiver->GetNumEntitiesAwaitingSpawn());
+	Counters.Set(ESpatialCounter::ActorPoolSize, NetDriver->Receiver->GetNumPooledActors());
+	Counters.Set(ESpatialCounter::PlayerLoginsQueued, NetDriver->PlayerSpawner->GetNumPendingPlayerSpawns());
+
+	// The lanes and their counters are declared in the same order.
+	USpatialWorkerConnection* Connection = NetDriver->Connection;
+	for (int32 Lane = 0; Lane < static_cast<int32>(SpatialGDK::EOutgoingMessageLane::Count); Lane++)
+	{
+		const SpatialGDK::EOutgoingMessageLane OutgoingLane = static_cast<SpatialGDK::EOutgoingMessageLane>(Lane);
+		Counters.Set(static_cast<ESpatialCounter>(static_cast<int32>(ESpatialCounter::OutgoingControlQueueDepth) + Lane), Connection->GetOutgoingQueueDepth(OutgoingLane));
+		Counters.Set(static_cast<ESpatialCounter>(static_cast<int32>(ESpatialCounter::OutgoingControlQueueMaxLatency) + Lane), Connection->ConsumeMaxOutgoingQueueLatencyMicroseconds(OutgoingLane));
+	}
+}
+
+void USpatialMetrics::SpatialDumpMetrics()
+{
+	SampleCounters();
+
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Average FPS: %.2f, load: %.4f (as of the last metrics report)"), AverageFPS, WorkerLoad);
+	NetDriver->GetCounters().Dump(*GLog);
+}
+
 void USpatialMetrics::SpatialStartRPCMetrics()
 {
 	if (bRPCTrackingEnabled)
@@ -83,6 +181,12 @@ void USpatialMetrics::SpatialStartRPCMetrics()
 	bRPCTrackingEnabled = true;
 	RPCTrackingStartTime = FPlatformTime::Seconds();
 
+	for (FRPCFunctionStats& Stats : RPCFunctionStats)
+	{
+		Stats.TrackedCalls = 0;
+		Stats.TrackedPayload = 0;
+	}
+
 	// If RPC tracking is activated on a client, send a command to the server to start tracking.
 	if (!NetDriver->IsServer())
 	{
@@ -117,29 +221,35 @@ void USpatialMetrics::SpatialStopRPCMetrics()
 	}
 
 	// Display recorded sent RPCs.
+	TArray<const FRPCFunctionStats*> RecentRPCArray;
+	for (const FRPCFunctionStats& Stats : RPCFunctionStats)
+	{
+		if (Stats.TrackedCalls > 0)
+		{
+			RecentRPCArray.Add(&Stats);
+		}
+	}
+
 	const double TrackRPCInterval = FPlatformTime::Seconds() - RPCTrackingStartTime;
-	UE_LOG(LogSpatialMetrics, Log, TEXT("Recorded %d unique RPCs over the last %.3f seconds:"), RecentRPCs.Num(), TrackRPCInterval);
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Recorded %d unique RPCs over the last %.3f seconds:"), RecentRPCArray.Num(), TrackRPCInterval);
 
-	if (RecentRPCs.Num() > 0)
+	if (RecentRPCArray.Num() > 0)
 	{
 		// NICELY log sent RPCs.
-		TArray<RPCStat> RecentRPCArray;
-		RecentRPCs.GenerateValueArray(RecentRPCArray);
-
 		// Show the most frequently called RPCs at the top.
-		RecentRPCArray.Sort([](const RPCStat& A, const RPCStat& B)
+		RecentRPCArray.Sort([](const FRPCFunctionStats& A, const FRPCFunctionStats& B)
 		{
 			if (A.Type != B.Type)
 			{
 				return static_cast<int>(A.Type) < static_cast<int>(B.Type);
 			}
-			return A.Calls > B.Calls;
+			return A.TrackedCalls > B.TrackedCalls;
 		});
 
 		int MaxRPCNameLen = 0;
-		for (RPCStat& Stat : RecentRPCArray)
+		for (const FRPCFunctionStats* Stat : RecentRPCArray)
 		{
-			MaxRPCNameLen = FMath::Max(MaxRPCNameLen, Stat.Name.Len());
+			MaxRPCNameLen = FMath::Max(MaxRPCNameLen, Stat->Name.Len());
 		}
 
 		int TotalCalls = 0;
@@ -152,23 +262,21 @@ void USpatialMetrics::SpatialStopRPCMetrics()
 		FString SeparatorLine = FString::Printf(TEXT("-------------------+-%s-+------------+------------+---------------+--------------+------------"), *FString::ChrN(MaxRPCNameLen, '-'));
 
 		ESchemaComponentType PrevType = SCHEMA_Invalid;
-		for (RPCStat& Stat : RecentRPCArray)
+		for (const FRPCFunctionStats* Stat : RecentRPCArray)
 		{
 			FString RPCTypeField;
-			if (Stat.Type != PrevType)
+			if (Stat->Type != PrevType)
 			{
-				RPCTypeField = RPCSchemaTypeToString(Stat.Type);
-				PrevType = Stat.Type;
+				RPCTypeField = RPCSchemaTypeToString(Stat->Type);
+				PrevType = Stat->Type;
 				UE_LOG(LogSpatialMetrics, Log, TEXT("%s"), *SeparatorLine);
 			}
-			UE_LOG(LogSpatialMetrics, Log, TEXT("%s | %s | %10d | %10.4f | %13d | %12.4f | %11.4f"), *RPCTypeField.RightPad(18), *Stat.Name.RightPad(MaxRPCNameLen), Stat.Calls, Stat.Calls / TrackRPCInterval, Stat.TotalPayload, (float)Stat.TotalPayload / Stat.Calls, Stat.TotalPayload / TrackRPCInterval);
-			TotalCalls += Stat.Calls;
-			TotalPayload += Stat.TotalPayload;
+			UE_LOG(LogSpatialMetrics, Log, TEXT("%s | %s | %10d | %10.4f | %13d | %12.4f | %11.4f"), *RPCTypeField.RightPad(18), *Stat->Name.RightPad(MaxRPCNameLen), Stat->TrackedCalls, Stat->TrackedCalls / TrackRPCInterval, Stat->TrackedPayload, (float)Stat->TrackedPayload / Stat->TrackedCalls, Stat->TrackedPayload / TrackRPCInterval);
+			TotalCalls += Stat->TrackedCalls;
+			TotalPayload += Stat->TrackedPayload;
 		}
 		UE_LOG(LogSpatialMetrics, Log, TEXT("%s"), *SeparatorLine);
 		UE_LOG(LogSpatialMetrics, Log, TEXT("Total              | %s | %10d | %10.4f | %13d | %12.4f | %11.4f"), *FString::ChrN(MaxRPCNameLen, ' '), TotalCalls, TotalCalls / TrackRPCInterval, TotalPayload, (float)TotalPayload / TotalCalls, TotalPayload / TrackRPCInterval);
-
-		RecentRPCs.Empty();
 	}
 
 	bRPCTrackingEnabled = false;
@@ -265,27 +373,87 @@ void USpatialMetrics::OnModifySettingCommand(Schema_Object* CommandPayload)
 	SpatialModifySetting(Name, Value);
 }
 
-void USpatialMetrics::TrackSentRPC(UFunction* Function, ESchemaComponentType RPCType, int PayloadSize)
+void USpatialMetrics::TrackSentRPC(UFunction* Function, ESchemaComponentType RPCType, const FPendingRPCParams& Params, uint32 SendStartCycles)
 {
-	if (!bRPCTrackingEnabled)
+	const bool bExportRPCMetrics = GetDefault<USpatialGDKSettings>()->bEnableRPCMetrics;
+	if (!bRPCTrackingEnabled && !bExportRPCMetrics)
 	{
 		return;
 	}
 
-	FString FunctionName = FString::Printf(TEXT("%s::%s"), *Function->GetOuter()->GetName(), *Function->GetName());
+	FRPCFunctionStats& Stats = FindOrAddRPCFunctionStats(Function, RPCType);
+	const int PayloadSize = Params.Payload.PayloadData.Num();
+
+	if (bRPCTrackingEnabled)
+	{
+		Stats.TrackedCalls++;
+		Stats.TrackedPayload += PayloadSize;
+	}
 
-	if (RecentRPCs.Find(FunctionName) == nullptr)
+	if (bExportRPCMetrics)
 	{
-		RPCStat Stat;
-		Stat.Name = FunctionName;
-		Stat.Type = RPCType;
-		Stat.Calls = 0;
-		Stat.TotalPayload = 0;
+		Stats.CallsSinceLastReport++;
+		Stats.PayloadBytes.Record(PayloadSize, RPC_PAYLOAD_BYTES_BASE_BOUND);
+		Stats.QueueDelayMs.Record((FPlatformTime::Seconds() - Params.QueuedTimestamp) * 1000.0, RPC_QUEUE_DELAY_MS_BASE_BOUND);
+		Stats.SendLatencyUs.Record(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles() - SendStartCycles) * 1000.0, RPC_SEND_LATENCY_US_BASE_BOUND);
+	}
+}
 
-		RecentRPCs.Add(FunctionName, Stat);
+USpatialMetrics::FRPCFunctionStats& USpatialMetrics::FindOrAddRPCFunctionStats(UFunction* Function, ESchemaComponentType RPCType)
+{
+	if (const int32* Index = RPCFunctionStatsIndices.Find(Function))
+	{
+		return RPCFunctionStats[*Index];
 	}
 
-	RPCStat& Stat = RecentRPCs[FunctionName];
-	Stat.Calls++;
-	Stat.TotalPayload += PayloadSize;
+	const int32 Index = RPCFunctionStats.AddDefaulted();
+	RPCFunctionStatsIndices.Add(Function, Index);
+
+	FRPCFunctionStats& Stats = RPCFunctionStats[Index];
+	Stats.Type = RPCType;
+	Stats.Name = FString::Printf(TEXT("%s::%s"), *Function->GetOuter()->GetName(), *Function->GetName());
+	Stats.TrackedCalls = 0;
+	Stats.TrackedPayload = 0;
+	Stats.CallsSinceLastReport = 0;
+
+	const std::string KeyPrefix = TCHAR_TO_UTF8(*(SpatialConstants::SPATIALOS_METRICS_RPC_FUNCTION_PREFIX + Stats.Name));
+	Stats.CallsKey = KeyPrefix + ".CallsPerSecond";
+	Stats.PayloadBytesKey = KeyPrefix + ".PayloadBytes";
+	Stats.QueueDelayKey = KeyPrefix + ".QueueDelayMs";
+	Stats.SendLatencyKey = KeyPrefix + ".SendLatencyUs";
+
+	return Stats;
+}
+
+void USpatialMetrics::AddRPCFunctionMetrics(SpatialGDK::SpatialMetrics& OutMetrics)
+{
+	for (FRPCFunctionStats& Stats : RPCFunctionStats)
+	{
+		if (Stats.CallsSinceLastReport == 0)
+		{
+			continue;
+		}
+
+		SpatialGDK::GaugeMetric CallsGauge;
+		CallsGauge.Key = Stats.CallsKey;
+		CallsGauge.Value = Stats.CallsSinceLastReport / TimeSinceLastReport;
+		OutMetrics.GaugeMetrics.Add(CallsGauge);
+
+		Stats.PayloadBytes.AddTo(OutMetrics, Stats.PayloadBytesKey, RPC_PAYLOAD_BYTES_BASE_BOUND);
+		Stats.QueueDelayMs.AddTo(OutMetrics, Stats.QueueDelayKey, RPC_QUEUE_DELAY_MS_BASE_BOUND);
+		Stats.SendLatencyUs.AddTo(OutMetrics, Stats.SendLatencyKey, RPC_SEND_LATENCY_US_BASE_BOUND);
+
+		Stats.CallsSinceLastReport = 0;
+		Stats.PayloadBytes.Reset();
+		Stats.QueueDelayMs.Reset();
+		Stats.SendLatencyUs.Reset();
+	}
+}
+
+void USpatialMetrics::TrackPackedRPCFlush(const FPackedRPCStats& Stats)
+{
+	PackedRPCUpdatesSinceLastReport += Stats.PackedUpdates;
+	PackedRPCsSinceLastReport += Stats.PackedRPCs;
+	PackedRPCBytesSinceLastReport += Stats.PackedBytes;
+	UnpackedSingleRPCsSinceLastReport += Stats.DirectRPCs;
 }
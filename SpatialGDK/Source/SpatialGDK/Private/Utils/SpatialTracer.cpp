@@ -0,0 +1,409 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SpatialTracer.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/ThreadManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/Archive.h"
+#include "Templates/Atomic.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialTracer);
+
+volatile bool FSpatialTracer::bEnabled = false;
+
+namespace
+{
+const uint32 TRACE_FILE_MAGIC = 0x52545053; // "SPTR"
+const uint32 TRACE_FILE_VERSION = 1;
+
+// 2MB per thread that records anything, the oldest events are overwritten once full.
+const uint32 RECORDS_PER_THREAD = 64 * 1024;
+
+const TCHAR* EVENT_NAMES[] =
+{
+	TEXT("ProcessOps"),
+	TEXT("Op.AddEntity"),
+	TEXT("Op.RemoveEntity"),
+	TEXT("Op.AddComponent"),
+	TEXT("Op.RemoveComponent"),
+	TEXT("Op.AuthorityChange"),
+	TEXT("Op.ComponentUpdate"),
+	TEXT("Op.CommandRequest"),
+	TEXT("Op.CommandResponse"),
+	TEXT("Op.Other"),
+	TEXT("ReplicateActor"),
+	TEXT("SerializeComponentData"),
+	TEXT("SerializeComponentUpdate"),
+	TEXT("OpsThread.Receive"),
+	TEXT("OpsThread.Send"),
+	TEXT("OpsThread.Decode"),
+};
+static_assert(ARRAY_COUNT(EVENT_NAMES) == static_cast<int32>(ESpatialTraceEvent::Count), "Every ESpatialTraceEvent needs an entry in EVENT_NAMES");
+
+// Written to the trace file as is, so keep the layout fixed.
+struct FTraceRecord
+{
+	uint64 Cycles;
+	int64 EntityId;
+	uint32 ComponentId;
+	uint32 Bytes;
+	uint16 Event;
+	uint8 bEnd;
+	uint8 Padding[5];
+};
+static_assert(sizeof(FTraceRecord) == 32, "FTraceRecord is written to trace files directly and must stay 32 bytes");
+
+// Only ever written by its own thread, and only while it is counted in RecordsInFlight. It is read when stopping,
+// after recording has been disabled and every in-flight record has finished.
+struct FThreadBuffer
+{
+	uint32 ThreadId;
+	FString ThreadName;
+	// Allocated by the first record of each trace and released once the trace is written.
+	TArray<FTraceRecord> Records;
+	uint64 NumRecorded;
+};
+
+// Owns every thread's buffer, so they are freed on shutdown even though threads only hold them through TLS.
+FCriticalSection ThreadBuffersLock;
+TArray<TUniquePtr<FThreadBuffer>> ThreadBuffers;
+uint32 ThreadBufferTlsSlot = FPlatformTLS::AllocTlsSlot();
+uint64 TraceStartCycles = 0;
+
+// Threads between checking that recording is enabled and finishing their record. Stop waits for this to reach zero.
+TAtomic<int32> RecordsInFlight(0);
+
+FThreadBuffer& GetThreadBuffer()
+{
+	FThreadBuffer* Buffer = static_cast<FThreadBuffer*>(FPlatformTLS::GetTlsValue(ThreadBufferTlsSlot));
+	if (Buffer == nullptr)
+	{
+		Buffer = new FThreadBuffer();
+		Buffer->ThreadId = FPlatformTLS::GetCurrentThreadId();
+		Buffer->ThreadName = IsInGameThread() ? FString(TEXT("GameThread")) : FThreadManager::Get().GetThreadName(Buffer->ThreadId);
+		Buffer->NumRecorded = 0;
+
+		FPlatformTLS::SetTlsValue(ThreadBufferTlsSlot, Buffer);
+
+		FScopeLock Lock(&ThreadBuffersLock);
+		ThreadBuffers.Emplace(Buffer);
+	}
+	return *Buffer;
+}
+
+FORCEINLINE void AddRecord(ESpatialTraceEvent Event, bool bEnd, Worker_EntityId EntityId, Worker_ComponentId ComponentId, uint32 Bytes)
+{
+	// Check again once counted, so a Stop that already saw no records in flight can't be raced.
+	RecordsInFlight++;
+	if (!FSpatialTracer::IsEnabled())
+	{
+		RecordsInFlight--;
+		return;
+	}
+
+	FThreadBuffer& Buffer = GetThreadBuffer();
+	if (Buffer.Records.Num() == 0)
+	{
+		Buffer.Records.SetNumUninitialized(RECORDS_PER_THREAD);
+	}
+
+	FTraceRecord& Record = Buffer.Records[static_cast<int32>(Buffer.NumRecorded % RECORDS_PER_THREAD)];
+	Record.Cycles = FPlatformTime::Cycles64();
+	Record.EntityId = EntityId;
+	Record.ComponentId = ComponentId;
+	Record.Bytes = Bytes;
+	Record.Event = static_cast<uint16>(Event);
+	Record.bEnd = bEnd ? 1 : 0;
+
+	Buffer.NumRecorded++;
+
+	RecordsInFlight--;
+}
+
+FString GetDefaultTracePath()
+{
+	return FPaths::ProfilingDir() / FString::Printf(TEXT("SpatialTrace-%s.sptrace"), *FDateTime::Now().ToString());
+}
+
+FAutoConsoleCommand StartTraceCommand(
+	TEXT("Spatial.Trace.Start"),
+	TEXT("Starts recording SpatialOS interop trace events."),
+	FConsoleCommandDelegate::CreateStatic(&FSpatialTracer::Start));
+
+FAutoConsoleCommand StopTraceCommand(
+	TEXT("Spatial.Trace.Stop"),
+	TEXT("Stops recording SpatialOS interop trace events and writes them to the given path, or Saved/Profiling by default."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FSpatialTracer::Stop(Args.Num() > 0 ? Args[0] : GetDefaultTracePath());
+	}));
+
+FAutoConsoleCommand ConvertTraceCommand(
+	TEXT("Spatial.Trace.ConvertToChrome"),
+	TEXT("Converts a SpatialOS interop trace file to Chrome trace format. Args: InPath [OutPath]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() == 0)
+		{
+			UE_LOG(LogSpatialTracer, Warning, TEXT("Spatial.Trace.ConvertToChrome: No trace file given."));
+			return;
+		}
+
+		FSpatialTracer::ConvertToChromeTrace(Args[0], Args.Num() > 1 ? Args[1] : FPaths::ChangeExtension(Args[0], TEXT("json")));
+	}));
+}
+
+void FSpatialTracer::Start()
+{
+	if (bEnabled)
+	{
+		UE_LOG(LogSpatialTracer, Log, TEXT("Already recording a trace."));
+		return;
+	}
+
+	{
+		FScopeLock Lock(&ThreadBuffersLock);
+		for (const TUniquePtr<FThreadBuffer>& Buffer : ThreadBuffers)
+		{
+			Buffer->NumRecorded = 0;
+		}
+	}
+
+	TraceStartCycles = FPlatformTime::Cycles64();
+	bEnabled = true;
+
+	UE_LOG(LogSpatialTracer, Log, TEXT("Started recording a trace."));
+}
+
+bool FSpatialTracer::Stop(const FString& Path)
+{
+	if (!bEnabled)
+	{
+		UE_LOG(LogSpatialTracer, Log, TEXT("Could not stop tracing, no trace is being recorded."));
+		return false;
+	}
+
+	bEnabled = false;
+	FPlatformMisc::MemoryBarrier();
+
+	// Wait for threads to finish any record they were in the middle of, new ones will see recording is disabled.
+	while (RecordsInFlight.Load() != 0)
+	{
+		FPlatformProcess::YieldThread();
+	}
+
+	FScopeLock Lock(&ThreadBuffersLock);
+
+	// The records are only needed until they're written, so don't keep 2MB per thread around between traces.
+	ON_SCOPE_EXIT
+	{
+		for (const TUniquePtr<FThreadBuffer>& Buffer : ThreadBuffers)
+		{
+			Buffer->Records.Empty();
+		}
+	};
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Path));
+	if (!Writer)
+	{
+		UE_LOG(LogSpatialTracer, Error, TEXT("Could not open %s to write the trace."), *Path);
+		return false;
+	}
+
+	uint32 Magic = TRACE_FILE_MAGIC;
+	uint32 Version = TRACE_FILE_VERSION;
+	double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+	*Writer << Magic << Version << SecondsPerCycle << TraceStartCycles;
+
+	uint32 NumEventNames = ARRAY_COUNT(EVENT_NAMES);
+	*Writer << NumEventNames;
+	for (const TCHAR* EventName : EVENT_NAMES)
+	{
+		FString Name = EventName;
+		*Writer << Name;
+	}
+
+	uint32 NumThreads = ThreadBuffers.Num();
+	*Writer << NumThreads;
+
+	uint64 TotalRecords = 0;
+	for (const TUniquePtr<FThreadBuffer>& Buffer : ThreadBuffers)
+	{
+		// Once the ring has wrapped, the oldest record is the one that would be overwritten next.
+		const uint32 NumRecords = static_cast<uint32>(FMath::Min<uint64>(Buffer->NumRecorded, RECORDS_PER_THREAD));
+		const uint32 FirstRecord = Buffer->NumRecorded > RECORDS_PER_THREAD ? static_cast<uint32>(Buffer->NumRecorded % RECORDS_PER_THREAD) : 0;
+
+		uint32 ThreadId = Buffer->ThreadId;
+		uint32 RecordCount = NumRecords;
+		*Writer << ThreadId << Buffer->ThreadName << RecordCount;
+
+		// Threads that recorded nothing during this trace never allocated their records.
+		if (NumRecords > 0)
+		{
+			const uint32 NumBeforeWrap = FMath::Min(NumRecords, RECORDS_PER_THREAD - FirstRecord);
+			Writer->Serialize(&Buffer->Records[FirstRecord], NumBeforeWrap * sizeof(FTraceRecord));
+			if (NumRecords > NumBeforeWrap)
+			{
+				Writer->Serialize(&Buffer->Records[0], (NumRecords - NumBeforeWrap) * sizeof(FTraceRecord));
+			}
+		}
+
+		TotalRecords += NumRecords;
+	}
+
+	Writer->Close();
+
+	UE_LOG(LogSpatialTracer, Log, TEXT("Wrote %llu trace events from %d threads to %s"), TotalRecords, ThreadBuffers.Num(), *Path);
+	return true;
+}
+
+bool FSpatialTracer::ConvertToChromeTrace(const FString& InPath, const FString& OutPath)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*InPath));
+	if (!Reader)
+	{
+		UE_LOG(LogSpatialTracer, Error, TEXT("Could not open trace %s."), *InPath);
+		return false;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	double SecondsPerCycle = 0.0;
+	uint64 StartCycles = 0;
+	*Reader << Magic << Version << SecondsPerCycle << StartCycles;
+
+	if (Magic != TRACE_FILE_MAGIC || Version != TRACE_FILE_VERSION)
+	{
+		UE_LOG(LogSpatialTracer, Error, TEXT("%s is not a trace file this version can read."), *InPath);
+		return false;
+	}
+
+	uint32 NumEventNames = 0;
+	*Reader << NumEventNames;
+
+	TArray<FString> EventNames;
+	EventNames.SetNum(NumEventNames);
+	for (FString& EventName : EventNames)
+	{
+		*Reader << EventName;
+	}
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*OutPath));
+	if (!Writer)
+	{
+		UE_LOG(LogSpatialTracer, Error, TEXT("Could not open %s to write the Chrome trace."), *OutPath);
+		return false;
+	}
+
+	auto WriteString = [&Writer](const FString& String)
+	{
+		FTCHARToUTF8 Converted(*String);
+		Writer->Serialize(const_cast<ANSICHAR*>(Converted.Get()), Converted.Length());
+	};
+
+	WriteString(TEXT("{\"traceEvents\":[\n"));
+
+	bool bFirstEvent = true;
+	auto WriteEvent = [&WriteString, &bFirstEvent](const FString& Event)
+	{
+		WriteString(bFirstEvent ? Event : TEXT(",\n") + Event);
+		bFirstEvent = false;
+	};
+
+	uint32 NumThreads = 0;
+	*Reader << NumThreads;
+
+	TArray<FTraceRecord> Records;
+	for (uint32 ThreadIndex = 0; ThreadIndex < NumThreads && !Reader->IsError(); ThreadIndex++)
+	{
+		uint32 ThreadId = 0;
+		FString ThreadName;
+		uint32 NumRecords = 0;
+		*Reader << ThreadId << ThreadName << NumRecords;
+
+		Records.SetNumUninitialized(NumRecords);
+		Reader->Serialize(Records.GetData(), NumRecords * sizeof(FTraceRecord));
+
+		WriteEvent(FString::Printf(TEXT("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s\"}}"), ThreadId, *ThreadName.ReplaceCharWithEscapedChar()));
+
+		// Ends whose begin was overwritten in the ring buffer would unbalance the timeline, so drop them.
+		int32 Depth = 0;
+		for (const FTraceRecord& Record : Records)
+		{
+			if (Record.bEnd)
+			{
+				if (Depth == 0)
+				{
+					continue;
+				}
+				Depth--;
+			}
+			else
+			{
+				Depth++;
+			}
+
+			const double TimestampUs = (static_cast<int64>(Record.Cycles - StartCycles)) * SecondsPerCycle * 1000000.0;
+			const FString& Name = EventNames.IsValidIndex(Record.Event) ? EventNames[Record.Event] : FString(TEXT("Unknown"));
+
+			WriteEvent(FString::Printf(TEXT("{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":0,\"tid\":%u,\"args\":{\"entity\":%lld,\"component\":%u,\"bytes\":%u}}"),
+				*Name, Record.bEnd ? TEXT("E") : TEXT("B"), TimestampUs, ThreadId, Record.EntityId, Record.ComponentId, Record.Bytes));
+		}
+	}
+
+	WriteString(TEXT("\n]}\n"));
+
+	if (Reader->IsError())
+	{
+		UE_LOG(LogSpatialTracer, Error, TEXT("Trace %s is truncated, the Chrome trace written to %s is incomplete."), *InPath, *OutPath);
+		return false;
+	}
+
+	UE_LOG(LogSpatialTracer, Log, TEXT("Converted trace %s to %s"), *InPath, *OutPath);
+	return true;
+}
+
+const TCHAR* FSpatialTracer::GetEventName(ESpatialTraceEvent Event)
+{
+	return EVENT_NAMES[static_cast<int32>(Event)];
+}
+
+ESpatialTraceEvent FSpatialTracer::GetOpEvent(Worker_OpType OpType)
+{
+	switch (OpType)
+	{
+	case WORKER_OP_TYPE_ADD_ENTITY:
+		return ESpatialTraceEvent::OpAddEntity;
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+		return ESpatialTraceEvent::OpRemoveEntity;
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		return ESpatialTraceEvent::OpAddComponent;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		return ESpatialTraceEvent::OpRemoveComponent;
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		return ESpatialTraceEvent::OpAuthorityChange;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+		return ESpatialTraceEvent::OpComponentUpdate;
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+		return ESpatialTraceEvent::OpCommandRequest;
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+		return ESpatialTraceEvent::OpCommandResponse;
+	default:
+		return ESpatialTraceEvent::OpOther;
+	}
+}
+
+void FSpatialTracer::RecordBegin(ESpatialTraceEvent Event, Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	AddRecord(Event, false, EntityId, ComponentId, 0);
+}
+
+void FSpatialTracer::RecordEnd(ESpatialTraceEvent Event, Worker_EntityId EntityId, Worker_ComponentId ComponentId, uint32 Bytes)
+{
+	AddRecord(Event, true, EntityId, ComponentId, Bytes);
+}
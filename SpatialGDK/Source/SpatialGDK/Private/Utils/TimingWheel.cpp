@@ -0,0 +1,263 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/TimingWheel.h"
+
+namespace
+{
+// Level 0 has 256 slots of one tick each, every level above has 64 slots each covering a whole turn of the level below.
+// With 10ms ticks that's 2.56s, 2.7min, 2.9h and 7.7 days of range respectively.
+const int32 LEVEL_0_BITS = 8;
+const int32 LEVEL_N_BITS = 6;
+const int32 NUM_LEVELS = 4;
+
+const int32 LEVEL_0_SLOTS = 1 << LEVEL_0_BITS;
+const int32 LEVEL_N_SLOTS = 1 << LEVEL_N_BITS;
+const int32 TOTAL_SLOTS = LEVEL_0_SLOTS + (NUM_LEVELS - 1) * LEVEL_N_SLOTS;
+
+const uint64 MAX_DELAY_TICKS = (uint64(1) << (LEVEL_0_BITS + (NUM_LEVELS - 1) * LEVEL_N_BITS)) - 1;
+
+int32 GetLevelShift(int32 Level)
+{
+	return Level == 0 ? 0 : LEVEL_0_BITS + (Level - 1) * LEVEL_N_BITS;
+}
+
+int32 GetSlotForTick(int32 Level, uint64 Tick)
+{
+	if (Level == 0)
+	{
+		return static_cast<int32>(Tick & (LEVEL_0_SLOTS - 1));
+	}
+
+	return LEVEL_0_SLOTS + (Level - 1) * LEVEL_N_SLOTS + static_cast<int32>((Tick >> GetLevelShift(Level)) & (LEVEL_N_SLOTS - 1));
+}
+}
+
+FTimingWheel::FTimingWheel()
+	: CurrentTick(0)
+	, AccumulatedSeconds(0.0f)
+	, NumActiveTimers(0)
+{
+	SlotHeads.Init(INDEX_NONE, TOTAL_SLOTS);
+}
+
+void FTimingWheel::SetTimer(FTimingWheelHandle& InOutHandle, TFunction<void()>&& Callback, float DelaySeconds, bool bLoop, float FirstDelaySeconds)
+{
+	int32 Index = INDEX_NONE;
+
+	if (GetActiveTimer(InOutHandle) != nullptr)
+	{
+		Index = InOutHandle.Index;
+		UnlinkTimer(Index);
+	}
+	else
+	{
+		Index = AllocateTimer();
+		InOutHandle.Index = Index;
+		InOutHandle.Generation = Timers[Index].Generation;
+	}
+
+	FTimer& Timer = Timers[Index];
+	Timer.Callback = MakeShared<TFunction<void()>>(MoveTemp(Callback));
+	Timer.IntervalTicks = bLoop ? SecondsToTicks(DelaySeconds) : 0;
+	Timer.ExpiryTick = CurrentTick + SecondsToTicks(FirstDelaySeconds >= 0.0f ? FirstDelaySeconds : DelaySeconds);
+
+	LinkTimer(Index);
+}
+
+bool FTimingWheel::ResetTimer(const FTimingWheelHandle& Handle, float DelaySeconds)
+{
+	FTimer* Timer = GetActiveTimer(Handle);
+	if (Timer == nullptr)
+	{
+		return false;
+	}
+
+	UnlinkTimer(Handle.Index);
+	Timer->ExpiryTick = CurrentTick + SecondsToTicks(DelaySeconds);
+	LinkTimer(Handle.Index);
+
+	return true;
+}
+
+void FTimingWheel::ClearTimer(FTimingWheelHandle& InOutHandle)
+{
+	if (GetActiveTimer(InOutHandle) != nullptr)
+	{
+		UnlinkTimer(InOutHandle.Index);
+		FreeTimer(InOutHandle.Index);
+	}
+
+	InOutHandle.Invalidate();
+}
+
+bool FTimingWheel::IsTimerActive(const FTimingWheelHandle& Handle) const
+{
+	return GetActiveTimer(Handle) != nullptr;
+}
+
+void FTimingWheel::Tick(float DeltaTime)
+{
+	AccumulatedSeconds += DeltaTime;
+
+	while (AccumulatedSeconds >= TICK_INTERVAL_SECONDS)
+	{
+		AccumulatedSeconds -= TICK_INTERVAL_SECONDS;
+		AdvanceOneTick();
+	}
+}
+
+uint64 FTimingWheel::SecondsToTicks(float Seconds) const
+{
+	// Always wait at least one tick, so a timer armed from a callback never fires in the same pass.
+	const uint64 Ticks = static_cast<uint64>(FMath::CeilToFloat(Seconds / TICK_INTERVAL_SECONDS));
+	return FMath::Clamp<uint64>(Ticks, 1, MAX_DELAY_TICKS);
+}
+
+FTimingWheel::FTimer* FTimingWheel::GetActiveTimer(const FTimingWheelHandle& Handle)
+{
+	if (!Timers.IsValidIndex(Handle.Index))
+	{
+		return nullptr;
+	}
+
+	FTimer& Timer = Timers[Handle.Index];
+	return (Timer.bActive && Timer.Generation == Handle.Generation) ? &Timer : nullptr;
+}
+
+const FTimingWheel::FTimer* FTimingWheel::GetActiveTimer(const FTimingWheelHandle& Handle) const
+{
+	return const_cast<FTimingWheel*>(this)->GetActiveTimer(Handle);
+}
+
+int32 FTimingWheel::AllocateTimer()
+{
+	int32 Index = FreeTimerIndices.Num() > 0 ? FreeTimerIndices.Pop(/* bAllowShrinking */ false) : Timers.AddDefaulted();
+
+	Timers[Index].bActive = true;
+	NumActiveTimers++;
+
+	return Index;
+}
+
+void FTimingWheel::FreeTimer(int32 Index)
+{
+	FTimer& Timer = Timers[Index];
+	Timer.Callback.Reset();
+	Timer.bActive = false;
+	Timer.Generation++;
+
+	FreeTimerIndices.Add(Index);
+	NumActiveTimers--;
+}
+
+void FTimingWheel::LinkTimer(int32 Index)
+{
+	FTimer& Timer = Timers[Index];
+
+	// Timers that are already due (only possible when cascading) go in the current level 0 slot.
+	const uint64 Delta = Timer.ExpiryTick > CurrentTick ? Timer.ExpiryTick - CurrentTick : 0;
+
+	int32 Level = 0;
+	while (Level < NUM_LEVELS - 1 && Delta >= (uint64(1) << GetLevelShift(Level + 1)))
+	{
+		Level++;
+	}
+
+	const int32 Slot = GetSlotForTick(Level, FMath::Max(Timer.ExpiryTick, CurrentTick));
+
+	Timer.Slot = Slot;
+	Timer.Prev = INDEX_NONE;
+	Timer.Next = SlotHeads[Slot];
+	if (Timer.Next != INDEX_NONE)
+	{
+		Timers[Timer.Next].Prev = Index;
+	}
+	SlotHeads[Slot] = Index;
+}
+
+void FTimingWheel::UnlinkTimer(int32 Index)
+{
+	FTimer& Timer = Timers[Index];
+	if (Timer.Slot == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (Timer.Prev != INDEX_NONE)
+	{
+		Timers[Timer.Prev].Next = Timer.Next;
+	}
+	else
+	{
+		SlotHeads[Timer.Slot] = Timer.Next;
+	}
+
+	if (Timer.Next != INDEX_NONE)
+	{
+		Timers[Timer.Next].Prev = Timer.Prev;
+	}
+
+	Timer.Slot = INDEX_NONE;
+	Timer.Prev = INDEX_NONE;
+	Timer.Next = INDEX_NONE;
+}
+
+int32 FTimingWheel::PopSlot(int32 Slot)
+{
+	const int32 Index = SlotHeads[Slot];
+	if (Index != INDEX_NONE)
+	{
+		UnlinkTimer(Index);
+	}
+	return Index;
+}
+
+void FTimingWheel::AdvanceOneTick()
+{
+	CurrentTick++;
+
+	// Whenever a lower level wraps around, pull the next slot of the level above down into it,
+	// starting from the highest level so that its timers can land in the levels being cascaded below.
+	int32 HighestLevelToCascade = 0;
+	while (HighestLevelToCascade < NUM_LEVELS - 1
+		&& (CurrentTick & ((uint64(1) << GetLevelShift(HighestLevelToCascade + 1)) - 1)) == 0)
+	{
+		HighestLevelToCascade++;
+	}
+
+	for (int32 Level = HighestLevelToCascade; Level > 0; Level--)
+	{
+		Cascade(Level);
+	}
+
+	// Fire everything due this tick. Timers armed by callbacks are always at least one tick out, so this terminates.
+	const int32 Slot = GetSlotForTick(0, CurrentTick);
+	for (int32 Index = PopSlot(Slot); Index != INDEX_NONE; Index = PopSlot(Slot))
+	{
+		FTimer& Timer = Timers[Index];
+
+		// Hold on to the callback, as it may clear or re-arm its own timer or grow the timer array.
+		TSharedPtr<TFunction<void()>> Callback = Timer.Callback;
+
+		if (Timer.IntervalTicks > 0)
+		{
+			Timer.ExpiryTick = CurrentTick + Timer.IntervalTicks;
+			LinkTimer(Index);
+		}
+		else
+		{
+			FreeTimer(Index);
+		}
+
+		(*Callback)();
+	}
+}
+
+void FTimingWheel::Cascade(int32 Level)
+{
+	const int32 Slot = GetSlotForTick(Level, CurrentTick);
+	for (int32 Index = PopSlot(Slot); Index != INDEX_NONE; Index = PopSlot(Slot))
+	{
+		LinkTimer(Index);
+	}
+}
@@ -0,0 +1,52 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/WorkerLoadEstimator.h"
+
+#include "SpatialGDKSettings.h"
+
+void FWorkerLoadEstimator::AddFrame(double FrameSeconds, double IdleSeconds)
+{
+	BusySeconds += FMath::Max(FrameSeconds - IdleSeconds, 0.0);
+	Frames++;
+}
+
+const FWorkerLoadEstimator::FLoadBreakdown& FWorkerLoadEstimator::Update(double TargetFrameSeconds, double PeriodSeconds, double OpsThreadBusySeconds)
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+	FLoadBreakdown Breakdown;
+
+	const double AvailableSeconds = Frames * TargetFrameSeconds;
+	if (AvailableSeconds > 0.0)
+	{
+		// Replication and receiving happen inside the frame, so whatever busy time is left over is gameplay.
+		const double GameplaySeconds = FMath::Max(BusySeconds - ReplicationSeconds - ReceiveSeconds, 0.0);
+
+		Breakdown.Replication = ReplicationSeconds / AvailableSeconds;
+		Breakdown.Receive = ReceiveSeconds / AvailableSeconds;
+		Breakdown.Gameplay = GameplaySeconds / AvailableSeconds;
+		Breakdown.GameThread = SpatialGDKSettings->LoadEstimateReplicationWeight * Breakdown.Replication
+			+ SpatialGDKSettings->LoadEstimateReceiveWeight * Breakdown.Receive
+			+ SpatialGDKSettings->LoadEstimateGameplayWeight * Breakdown.Gameplay;
+	}
+
+	if (PeriodSeconds > 0.0)
+	{
+		Breakdown.OpsThread = OpsThreadBusySeconds / PeriodSeconds;
+	}
+
+	// Exponentially weighted moving average, a smoothing factor of 1 only uses the latest period.
+	const double RawLoad = FMath::Max(Breakdown.GameThread, Breakdown.OpsThread);
+	const double Alpha = FMath::Clamp(static_cast<double>(SpatialGDKSettings->LoadEstimateSmoothingFactor), 0.01, 1.0);
+	Breakdown.Load = bHasSmoothedLoad ? Alpha * RawLoad + (1.0 - Alpha) * LastBreakdown.Load : RawLoad;
+	bHasSmoothedLoad = true;
+
+	LastBreakdown = Breakdown;
+
+	BusySeconds = 0.0;
+	ReplicationSeconds = 0.0;
+	ReceiveSeconds = 0.0;
+	Frames = 0;
+
+	return LastBreakdown;
+}
@@ -34,6 +34,31 @@ public:
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Interest")
 	bool bUseNetCullDistanceSquaredForCheckoutRadius = true;
 
+	/**
+	 * Whether to split the NetCullDistanceSquared checkout radius into two tiers. Entities in the near tier are checked out in full at
+	 * full rate, while entities further out only have the components needed to create their Actor, plus those of FarTierClasses, at FarTierFrequency.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Interest|LOD", meta = (EditCondition = "bUseNetCullDistanceSquaredForCheckoutRadius"))
+	bool bUseInterestLOD = false;
+
+	/**
+	 * The fraction of each NetCullDistanceSquared checkout radius that makes up the near tier.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Interest|LOD", meta = (EditCondition = "bUseInterestLOD", ClampMin = "0.0", ClampMax = "1.0"))
+	float NearTierRadiusFraction = 0.5f;
+
+	/**
+	 * The maximum frequency, in Hz, at which entities in the far tier are updated.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Interest|LOD", meta = (EditCondition = "bUseInterestLOD", ClampMin = "0.0"))
+	float FarTierFrequency = 2.0f;
+
+	/**
+	 * Actor classes (including derived classes) whose replicated properties are still checked out in the far tier.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Interest|LOD", meta = (EditCondition = "bUseInterestLOD"))
+	TArray<TSubclassOf<AActor>> FarTierClasses;
+
 	/**
 	 * The Queries associated with this component.
 	 */
@@ -7,6 +7,7 @@
 #include "EngineClasses/SpatialNetDriver.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/SpatialClassInfoManager.h"
+#include "Interop/SpatialConditionMapFilter.h"
 #include "Interop/SpatialStaticComponentView.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Schema/StandardLibrary.h"
@@ -70,20 +71,26 @@ public:
 	// Indicates whether this client worker has "ownership" (authority over Client endpoint) over the entity corresponding to this channel.
 	FORCEINLINE bool IsOwnedByWorker() const
 	{
-		const TArray<FString>& WorkerAttributes = NetDriver->Connection->GetWorkerAttributes();
-
 		if (const SpatialGDK::EntityAcl* EntityACL = NetDriver->StaticComponentView->GetComponentData<SpatialGDK::EntityAcl>(EntityId))
 		{
-			if (const WorkerRequirementSet* WorkerRequirementsSet = EntityACL->ComponentWriteAcl.Find(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID))
+			return IsClientEndpointOwnedBy(*EntityACL, NetDriver->Connection->GetWorkerAttributes());
+		}
+
+		return false;
+	}
+
+	// Whether a worker with these attributes can be authoritative over the Client endpoint according to the entity's ACL.
+	static FORCEINLINE bool IsClientEndpointOwnedBy(const SpatialGDK::EntityAcl& EntityACL, const TArray<FString>& WorkerAttributes)
+	{
+		if (const WorkerRequirementSet* WorkerRequirementsSet = EntityACL.ComponentWriteAcl.Find(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID))
+		{
+			for (const WorkerAttributeSet& AttributeSet : *WorkerRequirementsSet)
 			{
-				for (const WorkerAttributeSet& AttributeSet : *WorkerRequirementsSet)
+				for (const FString& Attribute : AttributeSet)
 				{
-					for (const FString& Attribute : AttributeSet)
+					if (WorkerAttributes.Contains(Attribute))
 					{
-						if (WorkerAttributes.Contains(Attribute))
-						{
-							return true;
-						}
+						return true;
 					}
 				}
 			}
@@ -92,6 +99,11 @@ public:
 		return false;
 	}
 
+	// Replication conditions for applying received updates. The owner check walks the entity's ACL, so it's only redone
+	// after InvalidateConditionMapFilter, while role and bRepPhysics are cheap to compare on every call.
+	const FSpatialConditionMapFilter& GetConditionMapFilter(bool bIsClient);
+	FORCEINLINE void InvalidateConditionMapFilter() { bConditionMapFilterValid = false; }
+
 	FORCEINLINE bool IsAuthoritativeServer()
 	{
 		return NetDriver->IsServer() && NetDriver->StaticComponentView->HasAuthority(EntityId, SpatialConstants::POSITION_COMPONENT_ID);
@@ -194,6 +206,13 @@ private:
 	// Used on the server to track when the owner changes.
 	FString SavedOwnerWorkerAttribute;
 
+	// Cached by GetConditionMapFilter, along with the state it was built from.
+	FSpatialConditionMapFilter ConditionMapFilter;
+	bool bConditionMapFilterValid;
+	bool bConditionMapNetOwner;
+	bool bConditionMapNetSimulated;
+	bool bConditionMapRepPhysics;
+
 	UPROPERTY(transient)
 	USpatialNetDriver* NetDriver;
 
@@ -7,6 +7,7 @@
 #include "Runtime/Launch/Resources/Version.h"
 
 #include "Schema/Interest.h"
+#include "Utils/TimingWheel.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -45,13 +46,11 @@ public:
 	///////
 	// End NetConnection Interface
 
-	void InitHeartbeat(class FTimerManager* InTimerManager, Worker_EntityId InPlayerControllerEntity);
-	void SetHeartbeatTimeoutTimer();
+	void InitHeartbeat(FTimingWheel* InTimingWheel, Worker_EntityId InPlayerControllerEntity);
 	void SetHeartbeatEventTimer();
 
 	void DisableHeartbeat();
 
-	void OnHeartbeat();
 	void UpdateActorInterest(AActor* Actor);
 
 	void ClientNotifyClientHasQuit();
@@ -62,9 +61,9 @@ public:
 	UPROPERTY()
 	FString WorkerAttribute;
 
-	class FTimerManager* TimerManager;
+	FTimingWheel* TimingWheel;
 
 	// Player lifecycle
 	Worker_EntityId PlayerControllerEntity;
-	FTimerHandle HeartbeatTimer;
+	FTimingWheelHandle HeartbeatTimer;
 };
@@ -13,6 +13,8 @@
 #include "Interop/SpatialOutputDevice.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/SpatialCounters.h"
+#include "Utils/TimingWheel.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -145,6 +147,12 @@ public:
 	int32 GetConsiderListSize() const { return ConsiderListSize; }
 #endif
 
+	// Used for the GDK's own high volume timers (heartbeats, RPC retries, entity range expiration) instead of TimerManager.
+	FTimingWheel& GetTimingWheel() { return TimingWheel; }
+
+	// Interop counters reported by SpatialMetrics, see FSpatialCounters for the catalogue.
+	FSpatialCounters& GetCounters() { return Counters; }
+
 	uint32 GetNextReliableRPCId(AActor* Actor, ESchemaComponentType RPCType, UObject* TargetObject);
 	void OnReceivedReliableRPC(AActor* Actor, ESchemaComponentType RPCType, FString WorkerId, uint32 RPCId, UObject* TargetObject, UFunction* Function);
 	void OnRPCAuthorityGained(AActor* Actor, ESchemaComponentType RPCType);
@@ -177,6 +185,8 @@ private:
 	TArray<Worker_OpList*> QueuedStartupOpLists;
 
 	FTimerManager TimerManager;
+	FTimingWheel TimingWheel;
+	FSpatialCounters Counters;
 
 	bool bAuthoritativeDestruction;
 	bool bConnectAsClient;
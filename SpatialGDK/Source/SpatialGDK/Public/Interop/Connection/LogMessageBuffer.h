@@ -0,0 +1,60 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+
+struct FBufferedLogMessage
+{
+	// Longest message stored in the slot itself.
+	static const int32 MAX_MESSAGE_BYTES = 480;
+	// Longer messages are allocated on the side up to this length, past which they're cut short and end in a marker
+	// saying how many bytes were left out.
+	static const int32 MAX_OVERFLOW_MESSAGE_BYTES = 16 * 1024;
+
+	// UTF-8 and null terminated, in OverflowMessage if it's longer than MAX_MESSAGE_BYTES.
+	const ANSICHAR* GetMessage() const { return OverflowMessage.Num() > 0 ? OverflowMessage.GetData() : Message; }
+
+	uint8 Level;
+	FName LoggerName;
+	// Bytes in the message, not counting the null terminator.
+	int32 Length;
+	ANSICHAR Message[MAX_MESSAGE_BYTES + 1];
+	TArray<ANSICHAR> OverflowMessage;
+};
+
+// Bounded multi-producer single-consumer queue of log messages. Any thread that logs can push without locking, and
+// messages pushed while the buffer is full are dropped and counted instead of blocking the caller. Only messages longer
+// than a slot allocate. Only the worker connection's ops thread pops.
+class SPATIALGDK_API FLogMessageBuffer
+{
+public:
+	// Must be a power of two.
+	static const uint32 CAPACITY = 1024;
+
+	FLogMessageBuffer();
+
+	bool Push(uint8 Level, const FName& LoggerName, const TCHAR* Message);
+	bool Pop(FBufferedLogMessage& OutMessage);
+
+	// Number of messages dropped because the buffer was full since the last call.
+	int32 ConsumeNumDropped() { return FPlatformAtomics::InterlockedExchange(&NumDropped, 0); }
+
+private:
+	struct FSlot
+	{
+		// Equal to the enqueue position when the slot is free, and the position + 1 once it has been written.
+		volatile int32 Sequence;
+		FBufferedLogMessage Data;
+	};
+
+	TArray<FSlot> Slots;
+
+	volatile int32 EnqueuePosition;
+	uint32 DequeuePosition;
+	volatile int32 NumDropped;
+};
+
+} // namespace SpatialGDK
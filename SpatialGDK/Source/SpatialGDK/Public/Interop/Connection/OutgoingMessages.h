@@ -4,6 +4,7 @@
 #include "Containers/Array.h"
 #include "Containers/UnrealString.h"
 #include "HAL/Platform.h"
+#include "Misc/AssertionMacros.h"
 #include "Misc/Optional.h"
 #include "Templates/UnrealTemplate.h"
 #include "Templates/UniquePtr.h"
@@ -11,6 +12,8 @@
 
 #include <string>
 
+#include "SpatialConstants.h"
+
 #include <WorkerSDK/improbable/c_worker.h>
 
 namespace SpatialGDK
@@ -27,18 +30,83 @@ enum class EOutgoingMessageType : int32
 	CommandRequest,
 	CommandResponse,
 	CommandFailure,
-	LogMessage,
 	ComponentInterest,
 	EntityQueryRequest,
 	Metrics
 };
 
+// Outgoing messages are queued per lane. Every ops thread update sends from the lanes in turn, a few messages from
+// each according to its weight, so bulk traffic can't hold up messages that players are waiting on.
+// Messages are only ordered within their lane, so everything that must stay ordered against an entity's component
+// traffic goes in the Replication lane.
+enum class EOutgoingMessageLane : uint8
+{
+	// Traffic players and servers wait on: RPCs, whether sent as commands or as updates of the RPC components, command
+	// responses and failures, and entity ID reservations.
+	Control,
+	// Component updates, additions and removals, and interest changes.
+	Replication,
+	// Entity creation and deletion, and entity queries. Limited to OutgoingBulkMessagesPerOpsUpdate per update.
+	Bulk,
+	// Metrics.
+	Diagnostics,
+	Count
+};
+
+// Updates of the components RPCs are written to.
+inline bool IsRPCComponent(Worker_ComponentId ComponentId)
+{
+	switch (ComponentId)
+	{
+	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID:
+	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID:
+	case SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID:
+	case SpatialConstants::CROSS_SERVER_RPC_SENDER_COMPONENT_ID:
+	case SpatialConstants::CROSS_SERVER_RPC_ACKS_COMPONENT_ID:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// RPCs can overtake earlier property updates of their target in the Control lane. That's the same as with two workers,
+// and an RPC whose arguments reference an object the receiver doesn't have yet is queued until it's resolved.
+inline EOutgoingMessageLane GetOutgoingMessageLane(EOutgoingMessageType Type, Worker_ComponentId ComponentId)
+{
+	switch (Type)
+	{
+	case EOutgoingMessageType::ReserveEntityIdsRequest:
+	case EOutgoingMessageType::CommandRequest:
+	case EOutgoingMessageType::CommandResponse:
+	case EOutgoingMessageType::CommandFailure:
+		return EOutgoingMessageLane::Control;
+	case EOutgoingMessageType::ComponentUpdate:
+		return IsRPCComponent(ComponentId) ? EOutgoingMessageLane::Control : EOutgoingMessageLane::Replication;
+	// Interest would overtake earlier component traffic for the same entity in a lane of its own.
+	case EOutgoingMessageType::AddComponent:
+	case EOutgoingMessageType::RemoveComponent:
+	case EOutgoingMessageType::ComponentInterest:
+		return EOutgoingMessageLane::Replication;
+	// Deletions share the lane with creations so a delete can't overtake the create of the same entity.
+	case EOutgoingMessageType::CreateEntityRequest:
+	case EOutgoingMessageType::DeleteEntityRequest:
+	case EOutgoingMessageType::EntityQueryRequest:
+		return EOutgoingMessageLane::Bulk;
+	case EOutgoingMessageType::Metrics:
+		return EOutgoingMessageLane::Diagnostics;
+	default:
+		checkNoEntry();
+		return EOutgoingMessageLane::Diagnostics;
+	}
+}
+
 struct FOutgoingMessage
 {
-	FOutgoingMessage(const EOutgoingMessageType& InType) : Type(InType) {}
+	FOutgoingMessage(const EOutgoingMessageType& InType) : Type(InType), QueuedCycles(0) {}
 	virtual ~FOutgoingMessage() {}
 
 	EOutgoingMessageType Type;
+	uint32 QueuedCycles;
 };
 
 struct FReserveEntityIdsRequest : FOutgoingMessage
@@ -147,20 +215,6 @@ struct FCommandFailure : FOutgoingMessage
 	FString Message;
 };
 
-struct FLogMessage : FOutgoingMessage
-{
-	FLogMessage(uint8_t InLevel, const FName& InLoggerName, const FString& InMessage)
-		: FOutgoingMessage(EOutgoingMessageType::LogMessage)
-		, Level(InLevel)
-		, LoggerName(InLoggerName)
-		, Message(InMessage)
-	{}
-
-	uint8_t Level;
-	FName LoggerName;
-	FString Message;
-};
-
 struct FComponentInterest : FOutgoingMessage
 {
 	FComponentInterest(Worker_EntityId InEntityId, TArray<Worker_InterestOverride>&& InInterests)
@@ -245,4 +299,12 @@ struct FMetrics : FOutgoingMessage
 	SpatialMetrics Metrics;
 };
 
+inline EOutgoingMessageLane GetOutgoingMessageLane(const FOutgoingMessage& Message)
+{
+	const Worker_ComponentId ComponentId = Message.Type == EOutgoingMessageType::ComponentUpdate
+		? static_cast<const FComponentUpdate&>(Message).Update.component_id
+		: SpatialConstants::INVALID_COMPONENT_ID;
+	return GetOutgoingMessageLane(Message.Type, ComponentId);
+}
+
 }
@@ -0,0 +1,41 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Schema/Component.h"
+#include "Schema/RPCPayload.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// An op list received from SpatialOS along with the data of the hand written components it adds, the updates to the ones
+// the static component view keeps up to date, and the RPCs sent on the RPC endpoints, all decoded on the ops thread so
+// the game thread only has to move them where they go. Whoever dispatches the op list is still responsible for destroying it.
+struct SPATIALGDK_API FPreDecodedOpList
+{
+	explicit FPreDecodedOpList(Worker_OpList* InOpList = nullptr);
+
+	void Decode();
+
+	bool IsDecoded() const { return DecodedComponents.Num() > 0; }
+
+	// Only valid once decoded. Null for components the static component view doesn't store data for.
+	TUniquePtr<ComponentStorageBase> TakeDecodedComponent(size_t OpIndex);
+	// Only valid once decoded. Null for components the static component view doesn't apply updates to.
+	TUniquePtr<ComponentUpdateStorageBase> TakeDecodedUpdate(size_t OpIndex);
+	// Only valid once decoded. Null for updates to anything but the RPC endpoint and multicast RPC components.
+	TUniquePtr<RPCEndpointEvents> TakeDecodedRPCs(size_t OpIndex);
+
+	Worker_OpList* OpList;
+
+private:
+	// Indexed by op.
+	TArray<TUniquePtr<ComponentStorageBase>> DecodedComponents;
+	TArray<TUniquePtr<ComponentUpdateStorageBase>> DecodedUpdates;
+	TArray<TUniquePtr<RPCEndpointEvents>> DecodedRPCs;
+};
+
+} // namespace SpatialGDK
@@ -4,9 +4,13 @@
 #include "Containers/Queue.h"
 #include "HAL/Runnable.h"
 #include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
 
 #include "Interop/Connection/ConnectionConfig.h"
+#include "Interop/Connection/LogMessageBuffer.h"
 #include "Interop/Connection/OutgoingMessages.h"
+#include "Interop/Connection/PreDecodedOpList.h"
 #include "SpatialGDKSettings.h"
 #include "UObject/WeakObjectPtr.h"
 
@@ -17,6 +21,7 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialWorkerConnection, Log, All);
 
+class FSpatialCounters;
 class USpatialGameInstance;
 class UWorld;
 
@@ -43,7 +48,7 @@ public:
 	FORCEINLINE bool IsConnected() { return bIsConnected; }
 
 	// Worker Connection Interface
-	TArray<Worker_OpList*> GetOpList();
+	TArray<SpatialGDK::FPreDecodedOpList> GetOpList();
 	Worker_RequestId SendReserveEntityIdsRequest(uint32_t NumOfEntities);
 	Worker_RequestId SendCreateEntityRequest(TArray<Worker_ComponentData>&& Components, const Worker_EntityId* EntityId);
 	Worker_RequestId SendDeleteEntityRequest(Worker_EntityId EntityId);
@@ -53,11 +58,25 @@ public:
 	Worker_RequestId SendCommandRequest(Worker_EntityId EntityId, const Worker_CommandRequest* Request, uint32_t CommandId);
 	void SendCommandResponse(Worker_RequestId RequestId, const Worker_CommandResponse* Response);
 	void SendCommandFailure(Worker_RequestId RequestId, const FString& Message);
+	// Safe to call from any thread. Log messages bypass the outgoing message queue and are sent in batches by the ops thread
+	// every LogForwardingInterval, so they can't hold up other traffic.
 	void SendLogMessage(uint8_t Level, const FName& LoggerName, const TCHAR* Message);
 	void SendComponentInterest(Worker_EntityId EntityId, TArray<Worker_InterestOverride>&& ComponentInterest);
 	Worker_RequestId SendEntityQueryRequest(const Worker_EntityQuery* EntityQuery);
 	void SendMetrics(const SpatialGDK::SpatialMetrics& Metrics);
 
+	// Set by the net driver that's using this connection, so sent component updates are counted in its metrics.
+	void SetCounters(FSpatialCounters* InCounters) { Counters = InCounters; }
+	FSpatialCounters* GetCounters() const { return Counters; }
+
+	int32 GetOutgoingQueueDepth(SpatialGDK::EOutgoingMessageLane Lane) const { return OutgoingLaneStats[static_cast<int32>(Lane)].Depth.GetValue(); }
+
+	// Longest time a message in the lane waited to be sent since the last call.
+	int32 ConsumeMaxOutgoingQueueLatencyMicroseconds(SpatialGDK::EOutgoingMessageLane Lane) { return FPlatformAtomics::InterlockedExchange(&OutgoingLaneStats[static_cast<int32>(Lane)].MaxLatencyMicroseconds, 0); }
+
+	// Time the ops thread spent processing rather than sleeping since the last call.
+	double ConsumeOpsThreadBusySeconds();
+
 	FString GetWorkerId() const;
 	const TArray<FString>& GetWorkerAttributes() const;
 
@@ -88,6 +107,10 @@ private:
 	void InitializeOpsProcessingThread();
 	void QueueLatestOpList();
 	void ProcessOutgoingMessages();
+	struct FOutgoingDrainState;
+	bool DequeueOutgoingMessage(TUniquePtr<SpatialGDK::FOutgoingMessage>& OutMessage, FOutgoingDrainState& DrainState);
+	void FlushLogMessages(bool bForce);
+	void SendLogMessageToWorker(uint8_t Level, const FName& LoggerName, const char* Message);
 
 	void StartDevelopmentAuth(FString DevAuthToken);
 	static void OnPlayerIdentityToken(void* UserData, const Worker_Alpha_PlayerIdentityTokenResponse* PIToken);
@@ -110,8 +133,49 @@ private:
 	FThreadSafeBool KeepRunning = true;
 	float OpsUpdateInterval;
 
-	TQueue<Worker_OpList*> OpListQueue;
-	TQueue<TUniquePtr<SpatialGDK::FOutgoingMessage>> OutgoingMessagesQueue;
+	TQueue<SpatialGDK::FPreDecodedOpList> OpListQueue;
+	struct FOutgoingLaneStats
+	{
+		FThreadSafeCounter Depth;
+		// Raised by the ops thread with a compare-exchange loop, reset by the game thread when reported.
+		volatile int32 MaxLatencyMicroseconds = 0;
+	};
+
+	static const int32 NUM_OUTGOING_LANES = static_cast<int32>(SpatialGDK::EOutgoingMessageLane::Count);
+
+	TQueue<TUniquePtr<SpatialGDK::FOutgoingMessage>> OutgoingMessagesQueues[NUM_OUTGOING_LANES];
+	FOutgoingLaneStats OutgoingLaneStats[NUM_OUTGOING_LANES];
+	// Maximum number of messages sent from each lane per ops thread update.
+	int32 OutgoingLaneBudgets[NUM_OUTGOING_LANES];
+	// Number of messages sent from each lane before moving on to the next one.
+	int32 OutgoingLaneWeights[NUM_OUTGOING_LANES];
+
+	// Where an ops thread update is in its round of the lanes.
+	struct FOutgoingDrainState
+	{
+		int32 RemainingLaneBudgets[NUM_OUTGOING_LANES];
+		int32 Lane;
+		int32 RemainingLaneWeight;
+	};
+	FThreadSafeCounter64 OpsThreadBusyCycles;
+
+	struct FPendingLogMessage
+	{
+		SpatialGDK::FBufferedLogMessage Message;
+		uint32 Count;
+	};
+
+	SpatialGDK::FLogMessageBuffer LogMessageBuffer;
+
+	// Only used by the ops thread.
+	TArray<FPendingLogMessage> PendingLogMessages;
+	TMap<uint32, int32> PendingLogMessageIndices;
+	float LogForwardingInterval;
+	float MaxForwardedLogMessagesPerSecond;
+	double LastLogFlushTime = 0.0;
+	double LogSendAllowance = 0.0;
+
+	FSpatialCounters* Counters = nullptr;
 
 	// RequestIds per worker connection start at 0 and incrementally go up each command sent.
 	Worker_RequestId NextRequestId = 0;
@@ -40,7 +40,10 @@ public:
 	bool IsSingletonEntity(Worker_EntityId EntityId) const;
 	void LinkAllExistingSingletonActors();
 	void ExecuteInitialSingletonActorReplication();
-	void UpdateSingletonEntityId(const FString& ClassName, const Worker_EntityId SingletonEntityId);
+	void UpdateSingletonEntityId(UClass* SingletonClass, const Worker_EntityId SingletonEntityId);
+	// Sends the singletons created since the last call to the GSM in a single update. The update still carries the whole
+	// singleton map, as SpatialOS map fields can only be replaced, so this batches updates rather than making them incremental.
+	void FlushSingletonManagerUpdates();
 
 	void QueryGSM(bool bRetryUntilAcceptingPlayers);
 	void RetryQueryGSM(bool bRetryUntilAcceptingPlayers);
@@ -70,8 +73,8 @@ public:
 
 	Worker_EntityId GlobalStateManagerEntityId;
 
-	// Singleton Manager Component
-	StringToEntityMap SingletonNameToEntityId;
+	// Singleton Manager Component, keyed by the data component ID of each singleton class.
+	ComponentIdToEntityMap SingletonClassIdToEntityId;
 
 	// Deployment Map Component
 	FString DeploymentMapURL;
@@ -88,7 +91,10 @@ public:
 	void ReceiveShutdownAdditionalServersEvent();
 #endif // WITH_EDITOR
 private:
-	void LinkExistingSingletonActor(const UClass* SingletonClass);
+	void LinkExistingSingletonActor(UClass* SingletonClass);
+	Worker_ComponentId GetSingletonClassId(UClass* SingletonClass) const;
+	void AddSingletonEntityId(Worker_ComponentId SingletonClassId, Worker_EntityId SingletonEntityId);
+	void SetSingletonClassIdToEntityId(ComponentIdToEntityMap&& InSingletonClassIdToEntityId);
 	void ApplyAcceptingPlayersUpdate(bool bAcceptingPlayersUpdate);
 	void ApplyCanBeginPlayUpdate(const bool bCanBeginPlayUpdate);
 
@@ -109,6 +115,11 @@ private:
 	UPROPERTY()
 	USpatialSender* Sender;
 
+	// Reverse index of SingletonClassIdToEntityId for IsSingletonEntity.
+	TSet<Worker_EntityId_Key> SingletonEntityIds;
+	// Singletons created on this worker that haven't been sent to the GSM yet.
+	ComponentIdToEntityMap PendingSingletonEntityIds;
+
 	UPROPERTY()
 	USpatialReceiver* Receiver;
 
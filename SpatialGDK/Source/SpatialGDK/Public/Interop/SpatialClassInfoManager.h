@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Utils/PropertyApplyPlan.h"
 #include "Utils/SchemaDatabase.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
@@ -41,6 +42,7 @@ struct FHandoverPropertyInfo
 	int32 Offset;
 	int32 ArrayIdx;
 	UProperty* Property;
+	SpatialGDK::FFieldApplyHandler Handler;
 };
 
 struct FInterestPropertyInfo
@@ -92,6 +94,8 @@ public:
 
 	bool TryInit(USpatialNetDriver* NetDriver, UActorGroupManager* ActorGroupManager);
 
+	virtual void BeginDestroy() override;
+
 	// Returns true if the class path corresponds to an Actor or Subobject class path in SchemaDatabase
 	// In PIE, PathName must be NetworkRemapped (bReading = false)
 	bool IsSupportedClass(const FString& PathName) const;
@@ -100,12 +104,19 @@ public:
 	const FClassInfo& GetOrCreateClassInfoByObject(UObject* Object);
 	const FClassInfo& GetClassInfoByComponentId(Worker_ComponentId ComponentId);
 
+	// Typed apply handlers for the replicated properties of Class, built from its RepLayout the first time they're needed.
+	// Dropped whenever a class is loaded, hot reloaded or garbage collected, so hold on to the returned plan while applying it.
+	TSharedRef<const SpatialGDK::FRepApplyPlan> GetOrCreateRepApplyPlan(UClass* Class, const FRepLayout& RepLayout);
+
 	UClass* GetClassByComponentId(Worker_ComponentId ComponentId);
 	bool GetOffsetByComponentId(Worker_ComponentId ComponentId, uint32& OutOffset);
 	ESchemaComponentType GetCategoryByComponentId(Worker_ComponentId ComponentId);
 
 	Worker_ComponentId GetComponentIdForClass(const UClass& Class) const;
 	TArray<Worker_ComponentId> GetComponentIdsForClassHierarchy(const UClass& BaseClass, const bool bIncludeDerivedTypes = true) const;
+
+	// Changes whenever the class hierarchy index used by GetComponentIdsForClassHierarchy is rebuilt, so anything derived from it can be cached.
+	uint32 GetClassHierarchyIndexVersion() const;
 	
 	const FRPCInfo& GetRPCInfo(UObject* Object, UFunction* Function);
 
@@ -124,6 +135,15 @@ private:
 
 	void QuitGame();
 
+	void BuildClassHierarchyIndex() const;
+	// Adds a class that was loaded after the index was built to it and its ancestors' entries.
+	void AddClassToHierarchyIndex(const UClass* Class, Worker_ComponentId ComponentId);
+	void InvalidateClassCaches();
+	void OnAssetLoaded(UObject* Asset);
+#if WITH_HOT_RELOAD
+	void OnHotReloadAddedClasses(const TArray<UClass*>& AddedClasses);
+#endif
+
 private:
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
@@ -135,4 +155,12 @@ private:
 	TMap<Worker_ComponentId, TSharedRef<FClassInfo>> ComponentToClassInfoMap;
 	TMap<Worker_ComponentId, uint32> ComponentToOffsetMap;
 	TMap<Worker_ComponentId, ESchemaComponentType> ComponentToCategoryMap;
+	TMap<TWeakObjectPtr<UClass>, TSharedRef<const SpatialGDK::FRepApplyPlan>> RepApplyPlanMap;
+
+	// Maps every loaded class to the sorted Actor component IDs of itself and its loaded descendants, used by GetComponentIdsForClassHierarchy.
+	// Rebuilt lazily from the SchemaDatabase after a class is loaded (in the editor), hot reloaded or garbage collected, so the raw class
+	// pointers never go stale. Classes are also added as their class info is created, which covers classes loaded in cooked builds.
+	mutable TMap<const UClass*, TArray<Worker_ComponentId>> ClassHierarchyComponentIds;
+	mutable bool bClassHierarchyIndexDirty = true;
+	mutable uint32 ClassHierarchyIndexVersion = 0;
 };
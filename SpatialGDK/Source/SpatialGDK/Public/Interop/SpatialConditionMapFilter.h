@@ -5,30 +5,23 @@
 #include "Engine/NetConnection.h"
 #include "Net/RepLayout.h"
 
-#include "EngineClasses/SpatialActorChannel.h"
-#include "EngineClasses/SpatialNetDriver.h"
-
 class FSpatialConditionMapFilter
 {
 public:
-	FSpatialConditionMapFilter(USpatialActorChannel* ActorChannel, bool bIsClient)
+	FSpatialConditionMapFilter()
+		: FSpatialConditionMapFilter(false, false, false)
+	{
+	}
+
+	FSpatialConditionMapFilter(bool bNetSimulated, bool bNetOwner, bool bRepPhysics)
 	{
 		// Reconstruct replication flags on the client side.
 		FReplicationFlags RepFlags;
 		RepFlags.bReplay = 0;
 		RepFlags.bNetInitial = 1; // The server will only ever send one update for bNetInitial, so just let them through here.
-		RepFlags.bNetSimulated = ActorChannel->Actor->Role == ROLE_SimulatedProxy;
-		RepFlags.bNetOwner = bIsClient && ActorChannel->IsOwnedByWorker();
-		RepFlags.bRepPhysics = ActorChannel->Actor->ReplicatedMovement.bRepPhysics;
-
-#if 0
-		UE_LOG(LogTemp, Verbose, TEXT("CMF Actor %s (%lld) NetOwner %d Simulated %d RepPhysics %d Client %s"),
-			*ActorChannel->Actor->GetName(),
-			ActorChannel->GetEntityId(),
-			RepFlags.bNetOwner,
-			RepFlags.bNetSimulated,
-			RepFlags.bRepPhysics);
-#endif
+		RepFlags.bNetSimulated = bNetSimulated;
+		RepFlags.bNetOwner = bNetOwner;
+		RepFlags.bRepPhysics = bRepPhysics;
 
 		// Build a ConditionMap. This code is taken directly from FRepLayout::RebuildConditionalProperties
 		static_assert(COND_Max == 14, "We are expecting 14 rep conditions"); // Guard in case more are added.
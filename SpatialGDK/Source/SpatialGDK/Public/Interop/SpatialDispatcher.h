@@ -17,6 +17,11 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialView, Log, All);
 
+namespace SpatialGDK
+{
+struct FPreDecodedOpList;
+}
+
 class USpatialNetDriver;
 class USpatialReceiver;
 class USpatialStaticComponentView;
@@ -31,6 +36,7 @@ public:
 
 	void Init(USpatialNetDriver* NetDriver);
 	void ProcessOps(Worker_OpList* OpList);
+	void ProcessOps(SpatialGDK::FPreDecodedOpList& OpList);
 	// The following 2 methods should *only* be used by the Startup OpList Queueing flow
 	// from the SpatialNetDriver, and should be temporary since an alternative solution will be available via the Worker SDK soon.
 	void MarkOpToSkip(const Worker_Op* Op);
@@ -60,13 +66,16 @@ private:
 		Worker_OpType OpType;
 	};
 
-	using OpTypeToCallbacksMap = TMap<Worker_OpType, TArray<UserOpCallbackData>>;
+	void ProcessOps(Worker_OpList* OpList, SpatialGDK::FPreDecodedOpList* PreDecodedOpList);
 
 	bool IsExternalSchemaOp(Worker_Op* Op) const;
 	void ProcessExternalSchemaOp(Worker_Op* Op);
 	FCallbackId AddGenericOpCallback(Worker_ComponentId ComponentId, Worker_OpType OpType, const TFunction<void(const Worker_Op*)>& Callback);
 	void RunCallbacks(Worker_ComponentId ComponentId, const Worker_Op* Op);
 
+	// Index into CallbackTable for a component ID in the external schema range and one of the component op types.
+	static int32 GetCallbackTableIndex(Worker_ComponentId ComponentId, Worker_OpType OpType);
+
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
 
@@ -80,8 +89,10 @@ private:
 	// CallbackIds enable you to deregister callbacks using the RemoveOpCallback function. 
 	// RunCallbacks is called by the SpatialDispatcher and executes all user registered 
 	// callbacks for the matching component ID and network operation type.
+	// CallbackTable is a flat table with an entry per external schema component ID and op type,
+	// only allocated once the first callback is registered.
 	FCallbackId NextCallbackId;
-	TMap<Worker_ComponentId, OpTypeToCallbacksMap> ComponentOpTypeToCallbacksMap;
+	TArray<TArray<UserOpCallbackData>> CallbackTable;
 	TMap<FCallbackId, CallbackIdData> CallbackIdToDataMap;
-	TArray<const Worker_Op*> OpsToSkip;
+	TSet<const Worker_Op*> OpsToSkip;
 };
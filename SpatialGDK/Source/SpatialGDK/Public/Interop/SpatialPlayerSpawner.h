@@ -15,6 +15,16 @@ DECLARE_LOG_CATEGORY_EXTERN(LogSpatialPlayerSpawner, Log, All);
 class FTimerManager;
 class USpatialNetDriver;
 
+// A player admitted by the spawner, waiting for its turn to be accepted.
+struct FPendingPlayerSpawn
+{
+	FString WorkerAttribute;
+	Worker_EntityId SpawnerEntityId;
+	FString URLString;
+	FUniqueNetIdRepl UniqueId;
+	FName OnlinePlatformName;
+};
+
 UCLASS()
 class SPATIALGDK_API USpatialPlayerSpawner : public UObject
 {
@@ -25,7 +35,13 @@ public:
 	void Init(USpatialNetDriver* NetDriver, FTimerManager* TimerManager);
 
 	// Server
-	void ReceivePlayerSpawnRequest(Schema_Object* Payload, const char* CallerAttribute, Worker_RequestId RequestId);
+	void ReceivePlayerSpawnRequest(Schema_Object* Payload, const char* CallerAttribute, Worker_RequestId RequestId, Worker_EntityId SpawnerEntityId);
+	// Accepts the admitted players, up to PlayerSpawnsPerTick of them, and only then responds to their spawn requests.
+	void ProcessPendingPlayerSpawns();
+	// Fails the spawn requests of players admitted through the spawner entity, or every spawner if INVALID_ENTITY_ID,
+	// that haven't been accepted yet, so their clients retry with whichever server handles the spawner next.
+	void FailPendingPlayerSpawns(Worker_EntityId SpawnerEntityId, const FString& Reason);
+	int32 GetNumPendingPlayerSpawns() const { return PendingPlayerSpawns.Num(); }
 
 	// Client
 	void SendPlayerSpawnRequest();
@@ -33,6 +49,8 @@ public:
 
 private:
 	void ObtainPlayerParams(struct FURL& LoginURL, FUniqueNetIdRepl& OutUniqueId, FName& OutOnlinePlatformName);
+	void SendPlayerSpawnCommand(Worker_EntityId SpawnerEntityId);
+	Worker_EntityId ChooseSpawnerEntityId() const;
 
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
@@ -41,4 +59,12 @@ private:
 	int NumberOfAttempts;
 
 	TSet<FString> WorkersWithPlayersSpawned;
+	TArray<FPendingPlayerSpawn> PendingPlayerSpawns;
+	// Spawn requests waiting on each pending player, more than one if the client retried while it was queued.
+	TMap<FString, TArray<Worker_RequestId>> PendingPlayerSpawnRequestIds;
+
+	// Spawner entities found by the last entity query, sorted. Spawners are part of the snapshot, so they're reused for
+	// every attempt instead of querying again.
+	TArray<Worker_EntityId> CachedSpawnerEntityIds;
+	bool bSpawnerEntityIdsQueried;
 };
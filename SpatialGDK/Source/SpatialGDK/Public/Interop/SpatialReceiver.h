@@ -8,13 +8,17 @@
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "Interop/SpatialClassInfoManager.h"
+#include "Schema/CrossServerRPCRingBuffer.h"
 #include "Schema/DynamicComponent.h"
 #include "Schema/RPCPayload.h"
 #include "Schema/SpawnData.h"
 #include "Schema/StandardLibrary.h"
 #include "Schema/UnrealObjectRef.h"
 #include "SpatialCommonTypes.h"
+#include "Utils/HeartbeatTracker.h"
+#include "Utils/QueuedRemoveComponentOps.h"
 #include "Utils/RPCContainer.h"
+#include "Utils/SpatialActorPool.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -38,6 +42,27 @@ struct PendingAddComponentWrapper
 	TUniquePtr<SpatialGDK::DynamicComponent> Data;
 };
 
+// Copy of a component update, kept until the entity it's for has been spawned.
+struct FParkedComponentUpdate
+{
+	explicit FParkedComponentUpdate(const Worker_ComponentUpdate& InUpdate)
+		: Update(Worker_AcquireComponentUpdate(&InUpdate)) {}
+	~FParkedComponentUpdate() { Worker_ReleaseComponentUpdate(Update); }
+
+	Worker_ComponentUpdate* Update;
+};
+
+// An entity checked out but not spawned yet, either because its Actor class is still loading asynchronously or because
+// it's queued behind the client's spawn budget. Everything received for it is held back until the Actor is spawned.
+struct FParkedEntity
+{
+	// The class package being loaded, or NAME_None if the entity is queued for spawning.
+	FName PackageName;
+	TArray<PendingAddComponentWrapper> PendingAddComponents;
+	TArray<Worker_AuthorityChangeOp> PendingAuthorityChanges;
+	TArray<TUniquePtr<FParkedComponentUpdate>> PendingUpdates;
+};
+
 struct FObjectReferences
 {
 	FObjectReferences() = default;
@@ -113,7 +138,7 @@ class USpatialReceiver : public UObject
 	GENERATED_BODY()
 
 public:
-	void Init(USpatialNetDriver* NetDriver, FTimerManager* InTimerManager);
+	void Init(USpatialNetDriver* NetDriver, FTimingWheel* InTimingWheel);
 
 	// Dispatcher Calls
 	void OnCriticalSection(bool InCriticalSection);
@@ -126,9 +151,11 @@ public:
 	void OnAuthorityChange(const Worker_AuthorityChangeOp& Op);
 
 	void OnComponentUpdate(const Worker_ComponentUpdateOp& Op);
-	void HandleRPC(const Worker_ComponentUpdateOp& Op);
+	// DecodedRPCs holds the update's RPCs if they were already read on the ops thread.
+	void OnComponentUpdate(const Worker_ComponentUpdateOp& Op, TUniquePtr<SpatialGDK::RPCEndpointEvents> DecodedRPCs);
+	void HandleRPC(const Worker_ComponentUpdateOp& Op, SpatialGDK::RPCEndpointEvents&& RPCs);
 
-	void ProcessRPCEventField(Worker_EntityId EntityId, const Worker_ComponentUpdateOp &Op, const Worker_ComponentId RPCEndpointComponentId, bool bPacked);
+	void ProcessRPC(const FUnrealObjectRef& ObjectRef, SpatialGDK::RPCPayload&& Payload);
 
 	void OnCommandRequest(const Worker_CommandRequestOp& Op);
 	void OnCommandResponse(const Worker_CommandResponseOp& Op);
@@ -149,6 +176,24 @@ public:
 
 	void ResolvePendingOperations(UObject* Object, const FUnrealObjectRef& ObjectRef);
 	void FlushRetryRPCs();
+	void FlushCrossServerRPCAcks();
+
+	// Executes or queues a cross-server RPC if we're authoritative over its target, returns whether we took it.
+	bool ReceiveCrossServerRPC(const FUnrealObjectRef& ObjectRef, SpatialGDK::RPCPayload&& Payload);
+	void CheckHeartbeatTimeouts();
+
+	// Sampled by SpatialMetrics when reporting.
+	int32 GetNumPendingActorRequests() const { return PendingActorRequests.Num(); }
+	int32 GetNumUnresolvedRefs() const { return UnresolvedRefsMap.Num(); }
+	int32 GetNumQueuedIncomingRPCs() const { return IncomingRPCs.GetNumQueuedRPCs(); }
+	int32 GetNumEntitiesAwaitingClassLoad() const;
+	int32 GetNumEntitiesAwaitingSpawn() const { return ParkedEntities.Num() - GetNumEntitiesAwaitingClassLoad(); }
+	int32 GetNumPooledActors() const { return ActorPool.GetNumPooledActors(); }
+
+	// Spawns the Actors for entities whose classes have finished loading since the last call.
+	void ProcessCompletedClassLoads();
+	// Spawns the Actors for queued entities, closest to the local player's view first, until the spawn budget is used up.
+	void ProcessQueuedSpawns();
 
 	void OnDisconnect(Worker_DisconnectOp& Op);
 
@@ -159,6 +204,7 @@ private:
 	void ReceiveActor(Worker_EntityId EntityId);
 	void RemoveActor(Worker_EntityId EntityId);
 	void DestroyActor(AActor* Actor, Worker_EntityId EntityId);
+	bool TryReleaseActorToPool(AActor* Actor, Worker_EntityId EntityId);
 
 	AActor* TryGetOrCreateActor(SpatialGDK::UnrealMetadata* UnrealMetadata, SpatialGDK::SpawnData* SpawnData);
 	AActor* CreateActor(SpatialGDK::UnrealMetadata* UnrealMetadata, SpatialGDK::SpawnData* SpawnData);
@@ -187,6 +233,14 @@ private:
 
 	bool IsReceivedEntityTornOff(Worker_EntityId EntityId);
 
+	bool ShouldLoadClassAsync(SpatialGDK::UnrealMetadata* UnrealMetadata) const;
+	void ParkEntityUntilClassLoaded(Worker_EntityId EntityId, const FString& ClassPath);
+	void OnClassPackageLoaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result);
+	bool ShouldQueueSpawn(Worker_EntityId EntityId, const TSet<Worker_EntityId_Key>& AuthoritativeEntities) const;
+	void QueueSpawn(Worker_EntityId EntityId);
+	void SpawnParkedEntity(Worker_EntityId EntityId, FParkedEntity& ParkedEntity);
+	bool GetSpawnPriorityLocation(FVector& OutLocation) const;
+
 	void QueueIncomingRepUpdates(FChannelObjectPair ChannelObjectPair, const FObjectReferencesMap& ObjectReferencesMap, const TSet<FUnrealObjectRef>& UnresolvedRefs);
 
 	void QueueIncomingRPC(FPendingRPCParamsPtr Params);
@@ -206,6 +260,10 @@ private:
 	AActor* FindSingletonActor(UClass* SingletonClass);
 
 	void OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp& Op);
+	void SetHeartbeatInterest(Worker_EntityId PlayerControllerEntity, bool bInterested);
+
+	void ProcessCrossServerRPCBatches(Worker_EntityId SenderWorkerEntityId, Schema_Object* SenderComponentObject);
+	void OnCrossServerRPCAcksChanged(Worker_EntityId ReceiverWorkerEntityId);
 
 public:
 	TMap<FUnrealObjectRef, TSet<FChannelObjectPair>> IncomingRefsMap;
@@ -231,7 +289,7 @@ private:
 	UPROPERTY()
 	UGlobalStateManager* GlobalStateManager;
 
-	FTimerManager* TimerManager;
+	FTimingWheel* TimingWheel;
 
 	// TODO: Figure out how to remove entries when Channel/Actor gets deleted - UNR:100
 	TMap<FChannelObjectPair, FObjectReferencesMap> UnresolvedRefsMap;
@@ -243,8 +301,19 @@ private:
 	bool bInCriticalSection;
 	TArray<Worker_EntityId> PendingAddEntities;
 	TArray<Worker_AuthorityChangeOp> PendingAuthorityChanges;
-	TArray<PendingAddComponentWrapper> PendingAddComponents;
-	TArray<Worker_RemoveComponentOp> QueuedRemoveComponentOps;
+	// Grouped by entity, so materializing each entity when leaving a critical section only visits its own components.
+	TMap<Worker_EntityId_Key, TArray<PendingAddComponentWrapper>> PendingAddComponents;
+	FQueuedRemoveComponentOps QueuedRemoveComponentOps;
+
+	TMap<Worker_EntityId_Key, FParkedEntity> ParkedEntities;
+	// Entities waiting on each package being loaded. Entities removed while waiting are left in, and skipped.
+	TMap<FName, TArray<Worker_EntityId>> ClassPackagesLoading;
+	TArray<TPair<FName, bool>> CompletedClassPackageLoads;
+	// Entities waiting on the spawn budget. Entities removed while waiting are left in, and skipped.
+	TArray<Worker_EntityId> QueuedSpawnEntities;
+
+	// Only used on clients.
+	FSpatialActorPool ActorPool;
 
 	TMap<Worker_RequestId, TWeakObjectPtr<USpatialActorChannel>> PendingActorRequests;
 	FReliableRPCMap PendingReliableRPCs;
@@ -254,9 +323,13 @@ private:
 	TMap<Worker_RequestId, CreateEntityDelegate> CreateEntityDelegates;
 
 	// This will map PlayerController entities to the corresponding SpatialNetConnection
-	// for PlayerControllers that this server has authority over. This is used for player
-	// lifecycle logic (Heartbeat component updates, disconnection logic).
-	TMap<Worker_EntityId_Key, TWeakObjectPtr<USpatialNetConnection>> AuthorityPlayerControllerConnectionMap;
+	// for PlayerControllers that this server has authority over, along with when they last sent
+	// a heartbeat. This is used for player lifecycle logic (Heartbeat component updates, disconnection logic).
+	FHeartbeatTracker HeartbeatTracker;
 
 	TMap<TPair<Worker_EntityId_Key, Worker_ComponentId>, PendingAddComponentWrapper> PendingDynamicSubobjectComponents;
+
+	// Batches of other servers' cross-server RPC ring buffers we have processed, published on our worker entity.
+	SpatialGDK::CrossServerRPCAcks LocalCrossServerRPCAcks;
+	bool bCrossServerRPCAcksDirty = false;
 };
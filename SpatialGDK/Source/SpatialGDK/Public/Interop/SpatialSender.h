@@ -6,8 +6,11 @@
 
 #include "EngineClasses/SpatialNetBitWriter.h"
 #include "Interop/SpatialClassInfoManager.h"
+#include "Schema/Interest.h"
 #include "Schema/RPCPayload.h"
+#include "SpatialConstants.h"
 #include "TimerManager.h"
+#include "Utils/CrossServerRPCSendBuffer.h"
 #include "Utils/RepDataUtils.h"
 #include "Utils/RPCContainer.h"
 
@@ -44,15 +47,26 @@ struct FReliableRPCForRetry
 	int RetryIndex; // Index for ordering reliable RPCs on subsequent tries
 };
 
-struct FPendingRPC
+// A packed RPC update being built for a player controller entity during the current frame.
+// RPC payloads are written straight into the update's schema buffer as they are added.
+struct FPendingPackedRPCUpdate
 {
-	FPendingRPC() = default;
-	FPendingRPC(FPendingRPC&& Other);
+	Worker_ComponentUpdate Update;
+	uint32 NumRPCs;
+	uint32 EstimatedSize;
 
-	uint32 Offset;
-	Schema_FieldId Index;
-	TArray<uint8> Data;
-	Schema_EntityId Entity;
+	// Target of the first RPC in this update, so it can be sent directly if it ends up being the only one.
+	Worker_EntityId FirstRPCEntity;
+	Worker_ComponentId FirstRPCComponentId;
+};
+
+// Packing statistics for a single FlushPackedRPCs call.
+struct FPackedRPCStats
+{
+	uint32 PackedUpdates = 0;
+	uint32 PackedRPCs = 0;
+	uint32 PackedBytes = 0;
+	uint32 DirectRPCs = 0;
 };
 
 // TODO: Clear TMap entries when USpatialActorChannel gets deleted - UNR:100
@@ -74,6 +88,8 @@ class SPATIALGDK_API USpatialSender : public UObject
 public:
 	void Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager);
 
+	virtual void BeginDestroy() override;
+
 	// Actor Updates
 	void SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges);
 	void SendComponentInterestForActor(USpatialActorChannel* Channel, Worker_EntityId EntityId, bool bNetOwned);
@@ -106,12 +122,19 @@ public:
 
 	bool UpdateEntityACLs(Worker_EntityId EntityId, const FString& OwnerWorkerAttribute);
 	void UpdateInterestComponent(AActor* Actor);
+	void ClearLastSentInterest(Worker_EntityId EntityId);
 
 	void ProcessRPC(FPendingRPCParamsPtr Params);
 	void QueueOutgoingRPC(FPendingRPCParamsPtr Params);
 	void ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId);
 
 	void FlushPackedRPCs();
+	void FlushCrossServerRPCs();
+
+	int32 GetNumQueuedOutgoingRPCs() const { return OutgoingRPCs.GetNumQueuedRPCs(); }
+
+	void OnCrossServerRPCAcksUpdated(Worker_EntityId ReceiverWorkerEntityId, const CrossServerRPCAcks& Acks);
+	void OnCrossServerRPCAcksRemoved(Worker_EntityId ReceiverWorkerEntityId);
 
 	RPCPayload CreateRPCPayloadFromParams(UObject* TargetObject, UFunction* Function, int ReliableRPCIndex, void* Params, TSet<TWeakObjectPtr<const UObject>>& UnresolvedObjects);
 	void GainAuthorityThenAddComponent(USpatialActorChannel* Channel, UObject* Object, const FClassInfo* Info);
@@ -135,9 +158,16 @@ private:
 	Worker_CommandRequest CreateRetryRPCCommandRequest(const FReliableRPCForRetry& RPC, uint32 TargetObjectOffset);
 	Worker_ComponentUpdate CreateRPCEventUpdate(UObject* TargetObject, const RPCPayload& Payload, Worker_ComponentId ComponentId, Schema_FieldId EventIndex, const UObject*& OutUnresolvedObject);
 	bool AddPendingRPC(UObject* TargetObject, const FPendingRPCParams& Parameters, Worker_ComponentId ComponentId, Schema_FieldId RPCIndex, const UObject*& OutUnresolvedObject);
+	FPendingPackedRPCUpdate& GetPackedRPCUpdateWithSpace(Worker_EntityId PlayerControllerEntityId, uint32 RequiredSize);
+	void SendSinglePackedRPCDirectly(FPendingPackedRPCUpdate& PackedUpdate);
+	bool CanSendCrossServerRPCBatches() const;
+	void ResolveCrossServerRPCBatches();
 
 	TArray<Worker_InterestOverride> CreateComponentInterestForActor(USpatialActorChannel* Channel, bool bIsNetOwned);
 
+	// Returns false if the Interest is identical to the last one sent for the entity, otherwise remembers it.
+	bool RecordSentInterest(Worker_EntityId EntityId, const SpatialGDK::Interest& NewInterest);
+
 private:
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
@@ -177,7 +207,21 @@ private:
 
 	FUpdatesQueuedUntilAuthority UpdatesQueuedUntilAuthorityMap;
 
+	// The Interest last sent per entity we're authoritative over, so rebuilding an unchanged Interest (e.g. when a sublevel
+	// without any replicated actors streams in) doesn't resend the whole component. The hash is compared first.
+	struct FSentInterest
+	{
+		uint32 Hash;
+		SpatialGDK::Interest SentInterest;
+	};
+	TMap<Worker_EntityId_Key, FSentInterest> LastSentInterests;
+
 	FChannelsToUpdatePosition ChannelsToUpdatePosition;
 
-	TMap<Worker_EntityId_Key, TArray<FPendingRPC>> RPCsToPack;
+	// Per player controller entity, the packed updates in flight this frame. A new update is started
+	// whenever adding an RPC would push the last one over MaxRPCPackedUpdateSize.
+	TMap<Worker_EntityId_Key, TArray<FPendingPackedRPCUpdate>> RPCsToPack;
+
+	// Cross-server RPC ring buffer on our worker entity, used when bUseRingBufferForCrossServerRPCs is set.
+	FCrossServerRPCSendBuffer CrossServerRPCs;
 };
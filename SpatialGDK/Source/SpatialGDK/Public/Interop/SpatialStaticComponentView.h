@@ -39,11 +39,21 @@ public:
 	bool HasComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 
 	void OnAddComponent(const Worker_AddComponentOp& Op);
+	// For component data already decoded with CreateComponentStorage.
+	void OnAddComponent(const Worker_AddComponentOp& Op, TUniquePtr<SpatialGDK::ComponentStorageBase> DecodedData);
 	void OnRemoveComponent(const Worker_RemoveComponentOp& Op);
 	void OnRemoveEntity(Worker_EntityId EntityId);
 	void OnComponentUpdate(const Worker_ComponentUpdateOp& Op);
+	// For updates already decoded with CreateComponentUpdateStorage.
+	void OnComponentUpdate(const Worker_ComponentUpdateOp& Op, TUniquePtr<SpatialGDK::ComponentUpdateStorageBase> DecodedUpdate);
 	void OnAuthorityChange(const Worker_AuthorityChangeOp& Op);
 
+	// Decodes the data of the components this view stores, and returns null for any other component.
+	// Doesn't touch the view, so it's safe to call from any thread.
+	static TUniquePtr<SpatialGDK::ComponentStorageBase> CreateComponentStorage(const Worker_ComponentData& ComponentData);
+	// Likewise decodes updates to the components this view applies updates to, and returns null for any other component.
+	static TUniquePtr<SpatialGDK::ComponentUpdateStorageBase> CreateComponentUpdateStorage(const Worker_ComponentUpdate& ComponentUpdate);
+
 private:
 	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, Worker_Authority>> EntityComponentAuthorityMap;
 	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, TUniquePtr<SpatialGDK::ComponentStorageBase>>> EntityComponentMap;
@@ -4,6 +4,7 @@
 
 #include <WorkerSDK/improbable/c_worker.h>
 #include "CoreMinimal.h"
+#include "Misc/Optional.h"
 
 namespace SpatialGDK
 {
@@ -43,4 +44,29 @@ private:
 	T data;
 };
 
+// A component update decoded ahead of being applied, for instance on the ops thread.
+class ComponentUpdateStorageBase
+{
+public:
+	virtual ~ComponentUpdateStorageBase(){};
+	virtual void ApplyTo(ComponentStorageBase& Data) const = 0;
+};
+
+// T must declare a T::DecodedUpdate read from a Worker_ComponentUpdate, and an ApplyUpdate taking it.
+template <typename T>
+class ComponentUpdateStorage : public ComponentUpdateStorageBase
+{
+public:
+	explicit ComponentUpdateStorage(const Worker_ComponentUpdate& InUpdate) : update{InUpdate} {}
+	~ComponentUpdateStorage() override {}
+
+	void ApplyTo(ComponentStorageBase& Data) const override
+	{
+		static_cast<ComponentStorage<T>&>(Data).Get().ApplyUpdate(update);
+	}
+
+private:
+	typename T::DecodedUpdate update;
+};
+
 } // namespace SpatialGDK
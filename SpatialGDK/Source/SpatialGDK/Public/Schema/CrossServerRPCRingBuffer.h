@@ -0,0 +1,224 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Schema/Component.h"
+#include "SpatialConstants.h"
+#include "Utils/SchemaUtils.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// Ring buffer of cross-server RPC batches written by the server worker owning this worker entity.
+// Batches are only read straight out of component ops by the receiver, so no state is kept here.
+struct CrossServerRPCSender : Component
+{
+	static const Worker_ComponentId ComponentId = SpatialConstants::CROSS_SERVER_RPC_SENDER_COMPONENT_ID;
+
+	static Schema_FieldId GetSlotFieldId(uint64 BatchId)
+	{
+		return SpatialConstants::CROSS_SERVER_RPC_SENDER_FIRST_SLOT_ID + static_cast<Schema_FieldId>(BatchId % SpatialConstants::CROSS_SERVER_RPC_RING_BUFFER_SIZE);
+	}
+
+	static Worker_ComponentData CreateCrossServerRPCSenderData()
+	{
+		Worker_ComponentData Data = {};
+		Data.component_id = ComponentId;
+		Data.schema_type = Schema_CreateComponentData(ComponentId);
+		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+
+		Schema_AddUint64(ComponentObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_LAST_SENT_BATCH_ID, 0);
+		Schema_AddUint64(ComponentObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_LAST_RESOLVED_BATCH_ID, 0);
+		for (uint32 Slot = 0; Slot < SpatialConstants::CROSS_SERVER_RPC_RING_BUFFER_SIZE; Slot++)
+		{
+			Schema_AddObject(ComponentObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_FIRST_SLOT_ID + Slot);
+		}
+
+		return Data;
+	}
+};
+
+// RPCs of one batch executed by the server worker owning the acks, one bit per RPC in batch order.
+struct CrossServerRPCBatchAck
+{
+	uint64 BatchId = 0;
+	TArray<uint64> ExecutedRPCs;
+
+	bool IsExecuted(int32 RPCIndex) const
+	{
+		const int32 WordIndex = RPCIndex / 64;
+		return WordIndex < ExecutedRPCs.Num() && (ExecutedRPCs[WordIndex] & (1ull << (RPCIndex % 64))) != 0;
+	}
+
+	void SetExecuted(int32 RPCIndex)
+	{
+		const int32 WordIndex = RPCIndex / 64;
+		if (WordIndex >= ExecutedRPCs.Num())
+		{
+			ExecutedRPCs.AddZeroed(WordIndex + 1 - ExecutedRPCs.Num());
+		}
+		ExecutedRPCs[WordIndex] |= 1ull << (RPCIndex % 64);
+	}
+};
+
+struct CrossServerRPCSenderAck
+{
+	uint64 LastAckedBatchId = 0;
+
+	// Only batches with executed RPCs, kept until the sender reports them resolved.
+	TArray<CrossServerRPCBatchAck> BatchAcks;
+
+	const CrossServerRPCBatchAck* FindBatchAck(uint64 BatchId) const
+	{
+		return BatchAcks.FindByPredicate([BatchId](const CrossServerRPCBatchAck& BatchAck) { return BatchAck.BatchId == BatchId; });
+	}
+};
+
+// Per sending worker entity, the last cross-server RPC batch processed by the server worker owning this worker entity,
+// and which RPCs of the unresolved batches it executed.
+struct CrossServerRPCAcks : Component
+{
+	static const Worker_ComponentId ComponentId = SpatialConstants::CROSS_SERVER_RPC_ACKS_COMPONENT_ID;
+
+	CrossServerRPCAcks() = default;
+
+	CrossServerRPCAcks(const Worker_ComponentData& Data)
+	{
+		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+		ReadSenderAcks(ComponentObject, SenderAcks);
+	}
+
+	struct DecodedUpdate
+	{
+		explicit DecodedUpdate(const Worker_ComponentUpdate& ComponentUpdate)
+		{
+			Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
+
+			// Maps are always sent in full, so an update either replaces or clears the whole map.
+			if (Schema_GetObjectCount(ComponentObject, SpatialConstants::CROSS_SERVER_RPC_ACKS_SENDER_ACKS_ID) > 0)
+			{
+				SenderAcks.Emplace();
+				ReadSenderAcks(ComponentObject, SenderAcks.GetValue());
+			}
+			else
+			{
+				uint32 ClearedFieldCount = Schema_GetComponentUpdateClearedFieldCount(ComponentUpdate.schema_type);
+				for (uint32 i = 0; i < ClearedFieldCount; i++)
+				{
+					if (Schema_IndexComponentUpdateClearedField(ComponentUpdate.schema_type, i) == SpatialConstants::CROSS_SERVER_RPC_ACKS_SENDER_ACKS_ID)
+					{
+						SenderAcks.Emplace();
+					}
+				}
+			}
+		}
+
+		TOptional<TMap<Worker_EntityId_Key, CrossServerRPCSenderAck>> SenderAcks;
+	};
+
+	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
+	{
+		ApplyUpdate(DecodedUpdate(Update));
+	}
+
+	void ApplyUpdate(const DecodedUpdate& Update)
+	{
+		if (Update.SenderAcks.IsSet())
+		{
+			SenderAcks = Update.SenderAcks.GetValue();
+		}
+	}
+
+	Worker_ComponentData CreateCrossServerRPCAcksData() const
+	{
+		Worker_ComponentData Data = {};
+		Data.component_id = ComponentId;
+		Data.schema_type = Schema_CreateComponentData(ComponentId);
+		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+
+		WriteSenderAcks(ComponentObject);
+
+		return Data;
+	}
+
+	Worker_ComponentUpdate CreateCrossServerRPCAcksUpdate() const
+	{
+		Worker_ComponentUpdate Update = {};
+		Update.component_id = ComponentId;
+		Update.schema_type = Schema_CreateComponentUpdate(ComponentId);
+		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
+
+		if (SenderAcks.Num() > 0)
+		{
+			WriteSenderAcks(ComponentObject);
+		}
+		else
+		{
+			Schema_AddComponentUpdateClearedField(Update.schema_type, SpatialConstants::CROSS_SERVER_RPC_ACKS_SENDER_ACKS_ID);
+		}
+
+		return Update;
+	}
+
+	TMap<Worker_EntityId_Key, CrossServerRPCSenderAck> SenderAcks;
+
+private:
+	static void ReadSenderAcks(Schema_Object* ComponentObject, TMap<Worker_EntityId_Key, CrossServerRPCSenderAck>& OutSenderAcks)
+	{
+		OutSenderAcks.Empty();
+
+		uint32 PairCount = Schema_GetObjectCount(ComponentObject, SpatialConstants::CROSS_SERVER_RPC_ACKS_SENDER_ACKS_ID);
+		for (uint32 i = 0; i < PairCount; i++)
+		{
+			Schema_Object* PairObject = Schema_IndexObject(ComponentObject, SpatialConstants::CROSS_SERVER_RPC_ACKS_SENDER_ACKS_ID, i);
+			Schema_Object* SenderAckObject = Schema_GetObject(PairObject, SCHEMA_MAP_VALUE_FIELD_ID);
+
+			CrossServerRPCSenderAck& SenderAck = OutSenderAcks.Add(Schema_GetEntityId(PairObject, SCHEMA_MAP_KEY_FIELD_ID));
+			SenderAck.LastAckedBatchId = Schema_GetUint64(SenderAckObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_ACK_LAST_ACKED_BATCH_ID);
+
+			uint32 BatchAckCount = Schema_GetObjectCount(SenderAckObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_ACK_BATCH_ACKS_ID);
+			for (uint32 j = 0; j < BatchAckCount; j++)
+			{
+				Schema_Object* BatchAckObject = Schema_IndexObject(SenderAckObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_ACK_BATCH_ACKS_ID, j);
+
+				SenderAck.BatchAcks.AddDefaulted();
+				CrossServerRPCBatchAck& BatchAck = SenderAck.BatchAcks.Last();
+				BatchAck.BatchId = Schema_GetUint64(BatchAckObject, SpatialConstants::CROSS_SERVER_RPC_BATCH_ACK_BATCH_ID);
+
+				uint32 WordCount = Schema_GetUint64Count(BatchAckObject, SpatialConstants::CROSS_SERVER_RPC_BATCH_ACK_EXECUTED_RPCS_ID);
+				BatchAck.ExecutedRPCs.SetNumUninitialized(WordCount);
+				for (uint32 k = 0; k < WordCount; k++)
+				{
+					BatchAck.ExecutedRPCs[k] = Schema_IndexUint64(BatchAckObject, SpatialConstants::CROSS_SERVER_RPC_BATCH_ACK_EXECUTED_RPCS_ID, k);
+				}
+			}
+		}
+	}
+
+	void WriteSenderAcks(Schema_Object* ComponentObject) const
+	{
+		for (const auto& Pair : SenderAcks)
+		{
+			Schema_Object* PairObject = Schema_AddObject(ComponentObject, SpatialConstants::CROSS_SERVER_RPC_ACKS_SENDER_ACKS_ID);
+			Schema_AddEntityId(PairObject, SCHEMA_MAP_KEY_FIELD_ID, Pair.Key);
+
+			Schema_Object* SenderAckObject = Schema_AddObject(PairObject, SCHEMA_MAP_VALUE_FIELD_ID);
+			Schema_AddUint64(SenderAckObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_ACK_LAST_ACKED_BATCH_ID, Pair.Value.LastAckedBatchId);
+
+			for (const CrossServerRPCBatchAck& BatchAck : Pair.Value.BatchAcks)
+			{
+				Schema_Object* BatchAckObject = Schema_AddObject(SenderAckObject, SpatialConstants::CROSS_SERVER_RPC_SENDER_ACK_BATCH_ACKS_ID);
+				Schema_AddUint64(BatchAckObject, SpatialConstants::CROSS_SERVER_RPC_BATCH_ACK_BATCH_ID, BatchAck.BatchId);
+				for (uint64 Word : BatchAck.ExecutedRPCs)
+				{
+					Schema_AddUint64(BatchAckObject, SpatialConstants::CROSS_SERVER_RPC_BATCH_ACK_EXECUTED_RPCS_ID, Word);
+				}
+			}
+		}
+	}
+};
+
+} // namespace SpatialGDK
@@ -137,6 +137,163 @@ struct ComponentInterest
 	TArray<Query> Queries;
 };
 
+// Exact comparison of the Interest inputs, so a hash collision can't stop a changed Interest from being sent.
+inline bool operator==(const Coordinates& A, const Coordinates& B)
+{
+	return A.X == B.X && A.Y == B.Y && A.Z == B.Z;
+}
+
+inline bool operator==(const SphereConstraint& A, const SphereConstraint& B)
+{
+	return A.Center == B.Center && A.Radius == B.Radius;
+}
+
+inline bool operator==(const CylinderConstraint& A, const CylinderConstraint& B)
+{
+	return A.Center == B.Center && A.Radius == B.Radius;
+}
+
+inline bool operator==(const BoxConstraint& A, const BoxConstraint& B)
+{
+	return A.Center == B.Center && A.EdgeLength == B.EdgeLength;
+}
+
+inline bool operator==(const RelativeSphereConstraint& A, const RelativeSphereConstraint& B)
+{
+	return A.Radius == B.Radius;
+}
+
+inline bool operator==(const RelativeCylinderConstraint& A, const RelativeCylinderConstraint& B)
+{
+	return A.Radius == B.Radius;
+}
+
+inline bool operator==(const RelativeBoxConstraint& A, const RelativeBoxConstraint& B)
+{
+	return A.EdgeLength == B.EdgeLength;
+}
+
+inline bool operator==(const QueryConstraint& A, const QueryConstraint& B)
+{
+	return A.SphereConstraint == B.SphereConstraint
+		&& A.CylinderConstraint == B.CylinderConstraint
+		&& A.BoxConstraint == B.BoxConstraint
+		&& A.RelativeSphereConstraint == B.RelativeSphereConstraint
+		&& A.RelativeCylinderConstraint == B.RelativeCylinderConstraint
+		&& A.RelativeBoxConstraint == B.RelativeBoxConstraint
+		&& A.EntityIdConstraint == B.EntityIdConstraint
+		&& A.ComponentConstraint == B.ComponentConstraint
+		&& A.AndConstraint == B.AndConstraint
+		&& A.OrConstraint == B.OrConstraint;
+}
+
+inline bool operator==(const Query& A, const Query& B)
+{
+	return A.Constraint == B.Constraint
+		&& A.FullSnapshotResult == B.FullSnapshotResult
+		&& A.ResultComponentId == B.ResultComponentId
+		&& A.Frequency == B.Frequency;
+}
+
+inline bool operator==(const ComponentInterest& A, const ComponentInterest& B)
+{
+	return A.Queries == B.Queries;
+}
+
+// Hashes of the Interest inputs, so an unchanged Interest can be detected without serializing it.
+// Primitive hashes are qualified, as the overloads below hide the global ones.
+inline uint32 GetTypeHash(const Coordinates& Coords)
+{
+	uint32 Result = ::GetTypeHash(Coords.X);
+	Result = HashCombine(Result, ::GetTypeHash(Coords.Y));
+	Result = HashCombine(Result, ::GetTypeHash(Coords.Z));
+	return Result;
+}
+
+inline uint32 GetTypeHash(const SphereConstraint& Constraint)
+{
+	return HashCombine(GetTypeHash(Constraint.Center), ::GetTypeHash(Constraint.Radius));
+}
+
+inline uint32 GetTypeHash(const CylinderConstraint& Constraint)
+{
+	return HashCombine(GetTypeHash(Constraint.Center), ::GetTypeHash(Constraint.Radius));
+}
+
+inline uint32 GetTypeHash(const BoxConstraint& Constraint)
+{
+	return HashCombine(GetTypeHash(Constraint.Center), GetTypeHash(Constraint.EdgeLength));
+}
+
+inline uint32 GetTypeHash(const RelativeSphereConstraint& Constraint)
+{
+	return ::GetTypeHash(Constraint.Radius);
+}
+
+inline uint32 GetTypeHash(const RelativeCylinderConstraint& Constraint)
+{
+	return ::GetTypeHash(Constraint.Radius);
+}
+
+inline uint32 GetTypeHash(const RelativeBoxConstraint& Constraint)
+{
+	return GetTypeHash(Constraint.EdgeLength);
+}
+
+inline uint32 GetTypeHash(const QueryConstraint& Constraint)
+{
+	uint32 Result = ::GetTypeHash(Constraint.SphereConstraint);
+	Result = HashCombine(Result, ::GetTypeHash(Constraint.CylinderConstraint));
+	Result = HashCombine(Result, ::GetTypeHash(Constraint.BoxConstraint));
+	Result = HashCombine(Result, ::GetTypeHash(Constraint.RelativeSphereConstraint));
+	Result = HashCombine(Result, ::GetTypeHash(Constraint.RelativeCylinderConstraint));
+	Result = HashCombine(Result, ::GetTypeHash(Constraint.RelativeBoxConstraint));
+	Result = HashCombine(Result, ::GetTypeHash(Constraint.EntityIdConstraint));
+	Result = HashCombine(Result, ::GetTypeHash(Constraint.ComponentConstraint));
+
+	// Salt the lists so moving a constraint from AND to OR changes the hash.
+	Result = HashCombine(Result, 0x414e44u + Constraint.AndConstraint.Num());
+	for (const QueryConstraint& AndConstraint : Constraint.AndConstraint)
+	{
+		Result = HashCombine(Result, GetTypeHash(AndConstraint));
+	}
+
+	Result = HashCombine(Result, 0x4f52u + Constraint.OrConstraint.Num());
+	for (const QueryConstraint& OrConstraint : Constraint.OrConstraint)
+	{
+		Result = HashCombine(Result, GetTypeHash(OrConstraint));
+	}
+
+	return Result;
+}
+
+inline uint32 GetTypeHash(const Query& InQuery)
+{
+	uint32 Result = GetTypeHash(InQuery.Constraint);
+
+	// bool has no GetTypeHash overload of its own.
+	Result = HashCombine(Result, InQuery.FullSnapshotResult.IsSet() ? (*InQuery.FullSnapshotResult ? 2u : 1u) : 0u);
+
+	Result = HashCombine(Result, InQuery.ResultComponentId.Num());
+	for (uint32 ComponentId : InQuery.ResultComponentId)
+	{
+		Result = HashCombine(Result, ::GetTypeHash(ComponentId));
+	}
+
+	Result = HashCombine(Result, ::GetTypeHash(InQuery.Frequency));
+	return Result;
+}
+
+inline uint32 GetTypeHash(const ComponentInterest& InComponentInterest)
+{
+	uint32 Result = ::GetTypeHash(InComponentInterest.Queries.Num());
+	for (const Query& ComponentQuery : InComponentInterest.Queries)
+	{
+		Result = HashCombine(Result, GetTypeHash(ComponentQuery));
+	}
+	return Result;
+}
+
 inline void AddQueryConstraintToQuerySchema(Schema_Object* QueryObject, Schema_FieldId Id, const QueryConstraint& Constraint)
 {
 	Schema_Object* QueryConstraintObject = Schema_AddObject(QueryObject, Id);
@@ -477,6 +634,36 @@ struct Interest : Component
 		}
 	}
 
+	// Hash of the whole component, a cheap check before comparing an Interest with the last one sent.
+	uint32 GetInterestHash() const
+	{
+		uint32 Result = ::GetTypeHash(ComponentInterestMap.Num());
+		for (const auto& KVPair : ComponentInterestMap)
+		{
+			Result = HashCombine(Result, ::GetTypeHash(KVPair.Key));
+			Result = HashCombine(Result, GetTypeHash(KVPair.Value));
+		}
+		return Result;
+	}
+
+	bool operator==(const Interest& Other) const
+	{
+		if (ComponentInterestMap.Num() != Other.ComponentInterestMap.Num())
+		{
+			return false;
+		}
+
+		for (const auto& KVPair : ComponentInterestMap)
+		{
+			const ComponentInterest* OtherValue = Other.ComponentInterestMap.Find(KVPair.Key);
+			if (OtherValue == nullptr || !(*OtherValue == KVPair.Value))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
 	TMap<uint32, ComponentInterest> ComponentInterestMap;
 };
 
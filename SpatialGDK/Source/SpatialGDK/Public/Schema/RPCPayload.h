@@ -43,6 +43,45 @@ struct RPCPayload
 	TArray<uint8> PayloadData;
 };
 
+// The RPCs sent as events in an update to the client or server RPC endpoint or the multicast RPC component.
+// Doesn't depend on anything but the update, so it's safe to read from any thread.
+struct RPCEndpointEvents
+{
+	struct PackedRPC
+	{
+		// Packed RPCs on the client and server endpoints always go through the PlayerController,
+		// so they carry the entity they're actually for.
+		Worker_EntityId TargetEntityId;
+		RPCPayload Payload;
+	};
+
+	explicit RPCEndpointEvents(const Worker_ComponentUpdate& Update)
+	{
+		Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Update.schema_type);
+		const bool bHasPackedTargets = Update.component_id == SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID ||
+			Update.component_id == SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID;
+
+		uint32 EventCount = Schema_GetObjectCount(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_EVENT_ID);
+		RPCs.Reserve(EventCount);
+		for (uint32 i = 0; i < EventCount; i++)
+		{
+			RPCs.Emplace(Schema_IndexObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_EVENT_ID, i));
+		}
+
+		uint32 PackedEventCount = Schema_GetObjectCount(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
+		PackedRPCs.Reserve(PackedEventCount);
+		for (uint32 i = 0; i < PackedEventCount; i++)
+		{
+			Schema_Object* EventData = Schema_IndexObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID, i);
+			const Worker_EntityId TargetEntityId = bHasPackedTargets ? Schema_GetEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID) : SpatialConstants::INVALID_ENTITY_ID;
+			PackedRPCs.Add(PackedRPC{ TargetEntityId, RPCPayload(EventData) });
+		}
+	}
+
+	TArray<RPCPayload> RPCs;
+	TArray<PackedRPC> PackedRPCs;
+};
+
 struct RPCsOnEntityCreation : Component
 {
 	static const Worker_ComponentId ComponentId = SpatialConstants::RPCS_ON_ENTITY_CREATION_ID;
@@ -24,12 +24,30 @@ struct ServerRPCEndpoint : Component
 		bReady = GetBoolFromSchema(EndpointObject, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID);
 	}
 
+	struct DecodedUpdate
+	{
+		explicit DecodedUpdate(const Worker_ComponentUpdate& ComponentUpdate)
+		{
+			Schema_Object* EndpointObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
+			if (Schema_GetBoolCount(EndpointObject, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID) > 0)
+			{
+				bReady = GetBoolFromSchema(EndpointObject, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID);
+			}
+		}
+
+		TOptional<bool> bReady;
+	};
+
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
 	{
-		Schema_Object* EndpointObject = Schema_GetComponentUpdateFields(Update.schema_type);
-		if (Schema_GetBoolCount(EndpointObject, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID) > 0)
+		ApplyUpdate(DecodedUpdate(Update));
+	}
+
+	void ApplyUpdate(const DecodedUpdate& Update)
+	{
+		if (Update.bReady.IsSet())
 		{
-			bReady = GetBoolFromSchema(EndpointObject, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID);
+			bReady = Update.bReady.GetValue();
 		}
 	}
 
@@ -93,28 +93,53 @@ struct EntityAcl : Component
 		}
 	}
 
+	// The fields set by an update, read without touching the component so it can be done off the game thread.
+	struct DecodedUpdate
+	{
+		explicit DecodedUpdate(const Worker_ComponentUpdate& ComponentUpdate)
+		{
+			Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
+
+			if (Schema_GetObjectCount(ComponentObject, 1) > 0)
+			{
+				ReadAcl = GetWorkerRequirementSetFromSchema(ComponentObject, 1);
+			}
+
+			// This is never emptied, so does not need an additional check for cleared fields
+			uint32 KVPairCount = Schema_GetObjectCount(ComponentObject, 2);
+			if (KVPairCount > 0)
+			{
+				ComponentWriteAcl.Emplace();
+				for (uint32 i = 0; i < KVPairCount; i++)
+				{
+					Schema_Object* KVPairObject = Schema_IndexObject(ComponentObject, 2, i);
+					uint32 Key = Schema_GetUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID);
+					WorkerRequirementSet Value = GetWorkerRequirementSetFromSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID);
+
+					ComponentWriteAcl->Add(Key, Value);
+				}
+			}
+		}
+
+		TOptional<WorkerRequirementSet> ReadAcl;
+		TOptional<WriteAclMap> ComponentWriteAcl;
+	};
+
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
 	{
-		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
+		ApplyUpdate(DecodedUpdate(Update));
+	}
 
-		if (Schema_GetObjectCount(ComponentObject, 1) > 0)
+	void ApplyUpdate(const DecodedUpdate& Update)
+	{
+		if (Update.ReadAcl.IsSet())
 		{
-			ReadAcl = GetWorkerRequirementSetFromSchema(ComponentObject, 1);
+			ReadAcl = Update.ReadAcl.GetValue();
 		}
 
-		// This is never emptied, so does not need an additional check for cleared fields
-		uint32 KVPairCount = Schema_GetObjectCount(ComponentObject, 2);
-		if (KVPairCount > 0)
+		if (Update.ComponentWriteAcl.IsSet())
 		{
-			ComponentWriteAcl.Empty();
-			for (uint32 i = 0; i < KVPairCount; i++)
-			{
-				Schema_Object* KVPairObject = Schema_IndexObject(ComponentObject, 2, i);
-				uint32 Key = Schema_GetUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID);
-				WorkerRequirementSet Value = GetWorkerRequirementSetFromSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID);
-
-				ComponentWriteAcl.Add(Key, Value);
-			}
+			ComponentWriteAcl = Update.ComponentWriteAcl.GetValue();
 		}
 	}
 
@@ -231,13 +256,31 @@ struct Position : Component
 		return ComponentUpdate;
 	}
 
+	struct DecodedUpdate
+	{
+		explicit DecodedUpdate(const Worker_ComponentUpdate& ComponentUpdate)
+		{
+			Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
+			if (Schema_GetObjectCount(ComponentObject, 1) > 0)
+			{
+				Coords = GetCoordinateFromSchema(ComponentObject, 1);
+			}
+		}
+
+		TOptional<Coordinates> Coords;
+	};
+
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
 	{
-		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
-		Schema_Object* CoordsObject = Schema_GetObject(ComponentObject, 1);
-		Coords.X = Schema_GetDouble(CoordsObject, 1);
-		Coords.Y = Schema_GetDouble(CoordsObject, 2);
-		Coords.Z = Schema_GetDouble(CoordsObject, 3);
+		ApplyUpdate(DecodedUpdate(Update));
+	}
+
+	void ApplyUpdate(const DecodedUpdate& Update)
+	{
+		if (Update.Coords.IsSet())
+		{
+			Coords = Update.Coords.GetValue();
+		}
 	}
 
 	Coordinates Coords;
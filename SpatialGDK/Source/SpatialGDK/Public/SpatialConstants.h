@@ -114,10 +114,15 @@ namespace SpatialConstants
 	const Worker_ComponentId RPCS_ON_ENTITY_CREATION_ID						= 9985;
 	const Worker_ComponentId DEBUG_METRICS_COMPONENT_ID						= 9984;
 	const Worker_ComponentId ALWAYS_RELEVANT_COMPONENT_ID					= 9983;
+	const Worker_ComponentId CROSS_SERVER_RPC_SENDER_COMPONENT_ID			= 9982;
+	const Worker_ComponentId CROSS_SERVER_RPC_ACKS_COMPONENT_ID				= 9981;
 
 	const Worker_ComponentId STARTING_GENERATED_COMPONENT_ID				= 10000;
 
-	const Schema_FieldId SINGLETON_MANAGER_SINGLETON_NAME_TO_ENTITY_ID		= 1;
+	const Schema_FieldId SINGLETON_MANAGER_SINGLETON_CLASS_ID_TO_ENTITY_ID	= 1;
+	const Schema_FieldId SINGLETON_MANAGER_SINGLETON_ENTITY_CREATED_EVENT_ID	= 1;
+	const Schema_FieldId SINGLETON_ENTITY_CREATED_CLASS_ID					= 1;
+	const Schema_FieldId SINGLETON_ENTITY_CREATED_ENTITY_ID					= 2;
 
 	const Schema_FieldId DEPLOYMENT_MAP_MAP_URL_ID							= 1;
 	const Schema_FieldId DEPLOYMENT_MAP_ACCEPTING_PLAYERS_ID				= 2;
@@ -135,6 +140,19 @@ namespace SpatialConstants
 
 	const Schema_FieldId CLEAR_RPCS_ON_ENTITY_CREATION						= 1;
 
+	const Schema_FieldId CROSS_SERVER_RPC_SENDER_LAST_SENT_BATCH_ID			= 1;
+	const Schema_FieldId CROSS_SERVER_RPC_SENDER_FIRST_SLOT_ID				= 2;
+	const Schema_FieldId CROSS_SERVER_RPC_SENDER_LAST_RESOLVED_BATCH_ID		= 18;
+	const Schema_FieldId CROSS_SERVER_RPC_BATCH_RPCS_ID						= 1;
+	const Schema_FieldId CROSS_SERVER_RPC_ACKS_SENDER_ACKS_ID				= 1;
+	const Schema_FieldId CROSS_SERVER_RPC_SENDER_ACK_LAST_ACKED_BATCH_ID		= 1;
+	const Schema_FieldId CROSS_SERVER_RPC_SENDER_ACK_BATCH_ACKS_ID			= 2;
+	const Schema_FieldId CROSS_SERVER_RPC_BATCH_ACK_BATCH_ID				= 1;
+	const Schema_FieldId CROSS_SERVER_RPC_BATCH_ACK_EXECUTED_RPCS_ID		= 2;
+	const uint32 CROSS_SERVER_RPC_RING_BUFFER_SIZE							= 16;
+	// Times a reliable cross-server RPC is sent again after a batch is read without any server executing it.
+	const uint32 CROSS_SERVER_RPC_MAX_RESENDS								= 64;
+
 	// DebugMetrics command IDs
 	const Schema_FieldId DEBUG_METRICS_START_RPC_METRICS_ID					= 1;
 	const Schema_FieldId DEBUG_METRICS_STOP_RPC_METRICS_ID					= 2;
@@ -197,6 +215,18 @@ namespace SpatialConstants
 	const Worker_ComponentId MAX_EXTERNAL_SCHEMA_ID = 2000;
 
 	const FString SPATIALOS_METRICS_DYNAMIC_FPS = TEXT("Dynamic.FPS");
+	const FString SPATIALOS_METRICS_PACKED_RPC_UPDATES = TEXT("RPC.PackedUpdatesPerFrame");
+	const FString SPATIALOS_METRICS_PACKED_RPCS = TEXT("RPC.PackedRPCsPerFrame");
+	const FString SPATIALOS_METRICS_PACKED_RPC_BYTES = TEXT("RPC.PackedBytesPerFrame");
+	const FString SPATIALOS_METRICS_UNPACKED_SINGLE_RPCS = TEXT("RPC.UnpackedSingleRPCsPerFrame");
+	const FString SPATIALOS_METRICS_ACTIVE_TIMERS = TEXT("GDK.ActiveTimers");
+	const FString SPATIALOS_METRICS_RPC_FUNCTION_PREFIX = TEXT("RPC.Function.");
+	const FString SPATIALOS_METRICS_LOAD_REPLICATION = TEXT("Load.Replication");
+	const FString SPATIALOS_METRICS_LOAD_RECEIVE = TEXT("Load.Receive");
+	const FString SPATIALOS_METRICS_LOAD_GAMEPLAY = TEXT("Load.Gameplay");
+	const FString SPATIALOS_METRICS_LOAD_GAME_THREAD = TEXT("Load.GameThread");
+	const FString SPATIALOS_METRICS_LOAD_OPS_THREAD = TEXT("Load.OpsThread");
+	const FString SPATIALOS_METRICS_LOAD_BUSY_TIME_ESTIMATE = TEXT("Load.BusyTimeEstimate");
 
 	const FString LOCATOR_HOST = TEXT("locator.improbable.io");
 	const uint16 LOCATOR_PORT = 443;
@@ -54,6 +54,13 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Heartbeat", meta = (ConfigRestartRequired = false, DisplayName = "Heartbeat Timeout (seconds)"))
 	float HeartbeatTimeoutSeconds;
 
+	/**
+	* Specifies whether server-worker instances receive heartbeat events for PlayerControllers they aren't authoritative over.
+	* (Only the authoritative server-worker instance acts on heartbeats, so disabling this saves sending every heartbeat to every server-worker instance that can see the PlayerController.)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Heartbeat", meta = (ConfigRestartRequired = true, DisplayName = "Heartbeat Interest For Non-Authoritative Servers"))
+	bool bEnableHeartbeatInterestForNonAuthoritativeServers;
+
 	/**
 	 * Specifies the maximum number of Actors replicated per tick.
 	 * Default: `0` per tick  (no limit)
@@ -79,6 +86,49 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "SpatialOS Network Update Rate"))
 	float OpsUpdateRate;
 
+	/**
+	* Maximum number of entity creations, deletions and entity queries handed to the SpatialOS Worker SDK per network update.
+	* Commands and component updates are sent in turn with them and aren't limited, so a burst of entity creations can't delay RPCs and replication. Set to 0 to disable the limit.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true, ClampMin = "0"))
+	int32 OutgoingBulkMessagesPerOpsUpdate;
+
+	/**
+	* EXPERIMENTAL: Load the classes of newly checked out Actors asynchronously instead of blocking the game thread.
+	* Everything received for an entity is held back until its class has loaded and the Actor is spawned. Other entities are unaffected.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	bool bAsyncLoadNewActorClasses;
+
+	/**
+	* Time in milliseconds clients may spend spawning newly checked out Actors per frame. Entities over the budget are queued
+	* and spawned on later frames, closest to the local player's view first. Set to 0 to spawn everything as soon as it's checked out.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, ClampMin = "0.0"))
+	float ClientEntitySpawnBudgetMs;
+
+	/**
+	* Maximum number of players a server accepts per tick. Clients are admitted straight away and accepted in the order they logged in.
+	* Set to 0 to accept every admitted player on the next tick.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Player Spawning", meta = (ConfigRestartRequired = false, ClampMin = "0"))
+	int32 PlayerSpawnsPerTick;
+
+	/**
+	* Number of player spawner entities generated in the snapshot. Clients are spread over them by worker ID, so logins can be
+	* handled by as many servers as there are spawners with authority assigned to different servers. Each spawner is placed in
+	* a different cell of the server workers' rectangle grid in the launch configuration, so the load balancer spreads them out.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Player Spawning", meta = (ConfigRestartRequired = true, ClampMin = "1"))
+	int32 PlayerSpawnerShardCount;
+
+	/**
+	* Actor classes whose Actors are kept and reused on clients when they leave view, with the maximum number kept per class.
+	* Only exact classes are pooled. Pooled Actors don't get BeginPlay and EndPlay again, implement ISpatialPooledActor to reset them.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true))
+	TMap<TSoftClassPtr<AActor>, int32> ActorPoolSizes;
+
 	/** Replicate handover properties between servers, required for zoned worker deployments.*/
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
 	bool bEnableHandover;
@@ -123,6 +173,45 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false))
 	bool bUseFrameTimeAsLoad;
 
+	/**
+	* Report load based on the time the game thread and the SpatialOS ops thread actually spend working, instead of frame time.
+	* Takes precedence over bUseFrameTimeAsLoad. The breakdown is reported as Load.* gauges either way.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false))
+	bool bUseBusyTimeAsLoad;
+
+	/** Weight of the time spent replicating Actors in the busy time load estimate.*/
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false, EditCondition = "bUseBusyTimeAsLoad", ClampMin = "0.0"))
+	float LoadEstimateReplicationWeight;
+
+	/** Weight of the time spent processing ops received from SpatialOS in the busy time load estimate.*/
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false, EditCondition = "bUseBusyTimeAsLoad", ClampMin = "0.0"))
+	float LoadEstimateReceiveWeight;
+
+	/** Weight of all other game thread work in the busy time load estimate.*/
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false, EditCondition = "bUseBusyTimeAsLoad", ClampMin = "0.0"))
+	float LoadEstimateGameplayWeight;
+
+	/** How much each report moves the busy time load estimate towards its latest value. 1 disables smoothing.*/
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false, EditCondition = "bUseBusyTimeAsLoad", ClampMin = "0.01", ClampMax = "1.0"))
+	float LoadEstimateSmoothingFactor;
+
+	/** Report per-function RPC call rates, payload sizes, queueing delays and send latencies to SpatialOS with the other metrics.*/
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false))
+	bool bEnableRPCMetrics;
+
+	/** Measure the serialized size of every component update sent for the Interop.ComponentUpdateBytes metrics. Walks each update, so only enable it while investigating bandwidth.*/
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false, EditCondition = "bEnableMetrics"))
+	bool bEnableComponentUpdateSizeMetrics;
+
+	/** Seconds between batches of log messages forwarded to SpatialOS. Repeats of a message within a batch are sent once with a count. Up to 1024 messages are buffered between batches, more are dropped and reported as a count. Messages longer than 16KB of UTF-8 are cut short and end in "…[truncated N bytes]".*/
+	UPROPERTY(EditAnywhere, config, Category = "Logging", meta = (ConfigRestartRequired = false, ClampMin = "0.0"))
+	float LogForwardingInterval;
+
+	/** Maximum number of log messages forwarded to SpatialOS per second. Messages over the limit are dropped and reported as a count. Errors are never dropped by the limit. Set to 0 to disable the limit.*/
+	UPROPERTY(EditAnywhere, config, Category = "Logging", meta = (ConfigRestartRequired = false, ClampMin = "0.0"))
+	float MaxForwardedLogMessagesPerSecond;
+
 	/** Include an order index with reliable RPCs and warn if they are executed out of order.*/
 	UPROPERTY(config, meta = (ConfigRestartRequired = false))
 	bool bCheckRPCOrder;
@@ -144,6 +233,14 @@ public:
 	UPROPERTY(config, meta = (ConfigRestartRequired = false))
 	bool bPackRPCs;
 
+	/** Approximate maximum size in bytes of a single packed RPC update. RPCs beyond this are packed into additional updates to the same player controller. */
+	UPROPERTY(config, meta = (ConfigRestartRequired = false))
+	uint32 MaxRPCPackedUpdateSize;
+
+	/** Experimental: send cross-server RPCs as batches through a ring buffer on each server worker entity instead of one command per RPC. Every server acknowledges each batch and the RPCs it executed; reliable RPCs no server executed, e.g. during an authority handoff, are sent again in a later batch. */
+	UPROPERTY(config, meta = (ConfigRestartRequired = true))
+	bool bUseRingBufferForCrossServerRPCs;
+
 	/** The receptionist host to use if no 'receptionistHost' argument is passed to the command line. */
 	UPROPERTY(EditAnywhere, config, Category = "Local Connection", meta = (ConfigRestartRequired = false))
 	FString DefaultReceptionistHost;
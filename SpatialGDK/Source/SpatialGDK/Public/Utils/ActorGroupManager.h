@@ -45,6 +45,12 @@ struct FActorGroupInfo
 	}
 };
 
+struct FClassActorGroup
+{
+	FName ActorGroup;
+	FName WorkerType;
+};
+
 UCLASS(Config=SpatialGDKSettings)
 class SPATIALGDK_API UActorGroupManager : public UObject
 {
@@ -55,11 +61,29 @@ private:
 
 	TMap<FName, FName> ActorGroupToWorkerType;
 
+	// Actor group and worker type of every class looked up so far, and of their Actor ancestors. Classes are resolved
+	// when their FClassInfo is created, so runtime lookups are a single hash lookup without walking the class hierarchy.
+	// Entries of collected classes are removed after garbage collection, and all of them on hot reload.
+	TMap<TWeakObjectPtr<UClass>, FClassActorGroup> ClassToActorGroup;
+
 	FName DefaultWorkerType;
 
+	// Checks the class's own soft class path, then inherits the actor group resolved for its parent.
+	FName ResolveActorGroupForClass(UClass* Class);
+
+	void RemoveStaleClassActorGroups();
+#if WITH_HOT_RELOAD
+	void OnHotReloadAddedClasses(const TArray<UClass*>& AddedClasses);
+#endif
+
 public:
 	void Init();
 
+	virtual void BeginDestroy() override;
+
+	// Returns the actor group and worker type of this class, resolving and caching them on the first lookup.
+	const FClassActorGroup& GetOrResolveClassActorGroup(UClass* Class);
+
 	// Returns the first ActorGroup that contains this, or a parent of this class,
 	// or the default actor group, if no mapping is found.
 	FName GetActorGroupForClass(TSubclassOf<AActor> Class);
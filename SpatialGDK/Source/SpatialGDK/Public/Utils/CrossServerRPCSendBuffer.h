@@ -0,0 +1,104 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Schema/CrossServerRPCRingBuffer.h"
+#include "Schema/RPCPayload.h"
+#include "Schema/UnrealObjectRef.h"
+#include "SpatialConstants.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogCrossServerRPCs, Log, All);
+
+// Sender side of the cross-server RPC ring buffer on a server worker entity. RPCs added during a frame are written into one
+// batch, flushed as a single update of the sender component. Sent batches keep their RPCs until every known server has
+// acknowledged them; reliable RPCs no server executed (e.g. because their target was mid authority handoff) are then
+// written into the next batch again, after which the batch's slot can be reused.
+class SPATIALGDK_API FCrossServerRPCSendBuffer
+{
+public:
+	~FCrossServerRPCSendBuffer();
+
+	// Returns false if the batch would overwrite a slot whose batch isn't resolved yet.
+	bool AddRPC(const FUnrealObjectRef& TargetObjectRef, const SpatialGDK::RPCPayload& Payload, bool bReliable);
+
+	// Moves the batch written since the last flush into OutUpdate, returns false if nothing was written.
+	bool FlushBatch(Worker_ComponentUpdate& OutUpdate);
+
+	// Calls Function(TargetObjectRef, Payload) for the RPCs of the last flushed batch. We don't receive our own ring buffer
+	// updates, so this is how RPCs to entities we're authoritative over are delivered; Function returns whether it executed the RPC.
+	template <typename FunctionType>
+	void ExecuteLastFlushedBatchLocally(FunctionType&& Function)
+	{
+		FSentBatch& Batch = GetSentBatch(LastSentBatchId);
+		for (int32 RPCIndex = 0; RPCIndex < Batch.RPCs.Num(); RPCIndex++)
+		{
+			if (Function(Batch.RPCs[RPCIndex].TargetObjectRef, Batch.RPCs[RPCIndex].Payload))
+			{
+				Batch.LocalAck.SetExecuted(RPCIndex);
+			}
+		}
+	}
+
+	// Acknowledgements from another server worker entity. Only known servers have to acknowledge a batch before it's resolved.
+	void SetReceiverAck(Worker_EntityId ReceiverWorkerEntityId, const SpatialGDK::CrossServerRPCSenderAck& Ack);
+	void RemoveReceiver(Worker_EntityId ReceiverWorkerEntityId);
+	int32 GetNumReceivers() const { return ReceiverAcks.Num(); }
+
+	// Resolves every sent batch all known servers have acknowledged, writing its reliable RPCs that none of them executed
+	// into the current batch. Returns the number of reliable RPCs given up on after CROSS_SERVER_RPC_MAX_RESENDS.
+	int32 ResolveAcknowledgedBatches();
+
+	uint64 GetLastSentBatchId() const { return LastSentBatchId; }
+	uint64 GetLastResolvedBatchId() const { return LastResolvedBatchId; }
+	int32 GetNumUnresolvedRPCs() const;
+
+private:
+	struct FSentRPC
+	{
+		FUnrealObjectRef TargetObjectRef;
+		SpatialGDK::RPCPayload Payload;
+		bool bReliable;
+		uint32 Resends;
+	};
+
+	struct FSentBatch
+	{
+		TArray<FSentRPC> RPCs;
+		SpatialGDK::CrossServerRPCBatchAck LocalAck;
+	};
+
+	bool OpenBatch();
+	void WriteRPC(FSentRPC&& RPC);
+	FSentBatch& GetSentBatch(uint64 BatchId) { return SentBatches[BatchId % SpatialConstants::CROSS_SERVER_RPC_RING_BUFFER_SIZE]; }
+
+	uint64 LastSentBatchId = 0;
+	uint64 LastResolvedBatchId = 0;
+
+	Worker_ComponentUpdate BatchUpdate = {};
+	Schema_Object* BatchObject = nullptr;
+
+	// Indexed the same way as the ring buffer slots. Holds the batch being written as well as the unresolved sent ones.
+	FSentBatch SentBatches[SpatialConstants::CROSS_SERVER_RPC_RING_BUFFER_SIZE];
+
+	TMap<Worker_EntityId_Key, SpatialGDK::CrossServerRPCSenderAck> ReceiverAcks;
+};
+
+namespace SpatialGDK
+{
+
+// Receiver side: reads the batches in a sender component's data or update that Ack hasn't acknowledged yet, in order.
+// ExecuteRPC(TargetObjectRef, Payload) returns whether this worker executed the RPC, which is recorded in Ack for the sender.
+// Returns whether Ack changed and has to be sent. The first time a sender is seen, use StartCrossServerRPCSenderAck instead.
+SPATIALGDK_API bool ReadCrossServerRPCBatches(Worker_EntityId SenderWorkerEntityId, Schema_Object* SenderComponentObject, CrossServerRPCSenderAck& Ack,
+	TFunctionRef<bool(const FUnrealObjectRef&, RPCPayload&&)> ExecuteRPC);
+
+// Batches already in a sender's ring buffer when we first see it were sent before we were watching, and are handled by
+// whichever servers were, so reading starts after them. Returns false if the sender hasn't written its ring buffer yet.
+SPATIALGDK_API bool StartCrossServerRPCSenderAck(Schema_Object* SenderComponentObject, CrossServerRPCSenderAck& OutAck);
+
+} // namespace SpatialGDK
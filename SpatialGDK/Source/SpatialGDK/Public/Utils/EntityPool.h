@@ -21,7 +21,7 @@ struct EntityRange
 };
 
 class USpatialReceiver;
-class FTimerManager;
+class FTimingWheel;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialEntityPool, Log, All)
 
@@ -31,7 +31,7 @@ class SPATIALGDK_API UEntityPool : public UObject
 	GENERATED_BODY()
 
 public:
-	void Init(USpatialNetDriver* InNetDriver, FTimerManager* TimerManager);
+	void Init(USpatialNetDriver* InNetDriver, FTimingWheel* TimingWheel);
 	void ReserveEntityIDs(int32 EntitiesToReserve);
 	Worker_EntityId GetNextEntityId();
 
@@ -49,7 +49,7 @@ private:
 	UPROPERTY()
 	USpatialReceiver* Receiver;
 
-	FTimerManager* TimerManager;
+	FTimingWheel* TimingWheel;
 	TArray<EntityRange> ReservedEntityIDRanges;
 
 	bool bIsReady;
@@ -0,0 +1,44 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+class USpatialNetConnection;
+
+// Tracks when each client connection this server is authoritative over last sent a heartbeat.
+// Last-seen times are kept in flat arrays indexed by connection, so a heartbeat is a lookup and a store,
+// and timed out connections are found with a single sweep per tick instead of a timer per connection.
+class SPATIALGDK_API FHeartbeatTracker
+{
+public:
+	void Add(Worker_EntityId PlayerControllerEntity, USpatialNetConnection* Connection, double Now);
+	void Remove(Worker_EntityId PlayerControllerEntity);
+
+	bool Contains(Worker_EntityId PlayerControllerEntity) const { return EntityToIndex.Contains(PlayerControllerEntity); }
+	int32 Num() const { return Entities.Num(); }
+
+	// Returns the connection for the PlayerController entity, or nullptr if it's not tracked or has been cleaned up.
+	USpatialNetConnection* GetConnection(Worker_EntityId PlayerControllerEntity) const;
+
+	// Returns false if the PlayerController entity isn't tracked.
+	bool RecordHeartbeat(Worker_EntityId PlayerControllerEntity, double Now);
+
+	// Stops tracking every connection that hasn't sent a heartbeat within TimeoutSeconds, or that has already been destroyed,
+	// and returns the ones that are still alive so the caller can clean them up.
+	void RemoveTimedOutConnections(double Now, double TimeoutSeconds, TArray<USpatialNetConnection*>& OutTimedOutConnections);
+
+private:
+	void RemoveAt(int32 Index);
+
+	TMap<Worker_EntityId_Key, int32> EntityToIndex;
+
+	TArray<Worker_EntityId> Entities;
+	TArray<double> LastSeenTimes;
+	TArray<TWeakObjectPtr<USpatialNetConnection>> Connections;
+};
@@ -10,6 +10,7 @@
 class USpatialNetDriver;
 class USpatialPackageMapClient;
 class AActor;
+class UActorInterestComponent;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogInterestFactory, Log, All);
 
@@ -25,9 +26,9 @@ public:
 
 	Worker_ComponentData CreateInterestData() const;
 	Worker_ComponentUpdate CreateInterestUpdate() const;
+	Interest CreateInterest() const;
 
 private:
-	Interest CreateInterest() const;
 
 	// Only uses Defined Constraint
 	Interest CreateActorInterest() const;
@@ -36,11 +37,16 @@ private:
 
 	void AddUserDefinedQueries(const QueryConstraint& LevelConstraints, TArray<SpatialGDK::Query>& OutQueries) const;
 
+	// Near and far checkout radius queries, replacing the single client query when the ActorInterestComponent enables interest LOD
+	bool AddInterestLODQueries(const QueryConstraint& LevelConstraints, TArray<SpatialGDK::Query>& OutQueries) const;
+	const UActorInterestComponent* GetActorInterestComponent() const;
+
 	// Checkout Constraint OR AlwaysInterested Constraint
 	QueryConstraint CreateSystemDefinedConstraints() const;
 
 	// System Defined Constraints
 	QueryConstraint CreateCheckoutRadiusConstraints() const;
+	QueryConstraint BuildCheckoutRadiusConstraintTemplate() const;
 	QueryConstraint CreateAlwaysInterestedConstraint() const;
 	QueryConstraint CreateAlwaysRelevantConstraint() const;
 
@@ -0,0 +1,77 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FRepLayout;
+class UArrayProperty;
+class UProperty;
+class UScriptStruct;
+
+namespace SpatialGDK
+{
+
+// Schema representation of a single property value, resolved once per property so applying a field doesn't need to walk a Cast chain.
+enum class EPropertyApplyKind : uint8
+{
+	Unknown,
+	Struct,
+	Bool,
+	Float,
+	Double,
+	Int8,
+	Int16,
+	Int32,
+	Int64,
+	Byte,
+	UInt16,
+	UInt32,
+	UInt64,
+	Object,
+	Name,
+	Str,
+	Text,
+	// Enums smaller than 4 bytes are sent as uint32 and written through their underlying property.
+	SmallEnum
+};
+
+struct FPropertyApplyHandler
+{
+	EPropertyApplyKind Kind = EPropertyApplyKind::Unknown;
+
+	// The property the value is written through. For enums this is the underlying numeric property.
+	UProperty* Property = nullptr;
+};
+
+// How a schema field is applied: either a single value, or a dynamic array with one value per element.
+struct FFieldApplyHandler
+{
+	FPropertyApplyHandler Element;
+
+	// Only set for dynamic arrays, in which case Element describes the inner property.
+	UArrayProperty* ArrayProperty = nullptr;
+};
+
+struct FRepFieldApplyHandler : FFieldApplyHandler
+{
+	int32 CmdIndex = INDEX_NONE;
+
+	// Set for FFastArraySerializer arrays, which are delta serialized instead of applied per element.
+	UScriptStruct* NetDeltaStruct = nullptr;
+
+	bool bIsRemoteRole = false;
+};
+
+// Replicated fields of a class, indexed by schema field ID - 1 (the same as the rep handle - 1).
+struct FRepApplyPlan
+{
+	TArray<FRepFieldApplyHandler> Fields;
+};
+
+FPropertyApplyHandler MakePropertyApplyHandler(UProperty* Property);
+FFieldApplyHandler MakeFieldApplyHandler(UProperty* Property);
+
+TSharedRef<const FRepApplyPlan> BuildRepApplyPlan(const FRepLayout& RepLayout);
+
+} // namespace SpatialGDK
@@ -0,0 +1,55 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SpatialCommonTypes.h"
+#include "SpatialConstants.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+// Remove component ops queued until the end of an op list, indexed by entity so dropping the ops of a removed entity only
+// visits that entity's ops. Entities are flushed in the order their first op arrived, and each entity's ops in arrival order.
+// Ops of different entities don't depend on each other, so interleaving them by entity rather than by op is fine.
+// The flush order is a doubly linked list through the queued entities, so dropping an entity unlinks it in O(1).
+class SPATIALGDK_API FQueuedRemoveComponentOps
+{
+public:
+	void Add(const Worker_RemoveComponentOp& Op);
+
+	// Drops every op queued for the entity.
+	void RemoveEntity(Worker_EntityId EntityId);
+
+	// Calls Function for every op that hasn't been dropped.
+	template <typename FunctionType>
+	void ForEach(FunctionType&& Function) const
+	{
+		for (Worker_EntityId EntityId = FirstEntityId; EntityId != SpatialConstants::INVALID_ENTITY_ID;)
+		{
+			const FEntityOps& Entity = OpsByEntity.FindChecked(EntityId);
+			for (const Worker_RemoveComponentOp& Op : Entity.Ops)
+			{
+				Function(Op);
+			}
+			EntityId = Entity.NextEntityId;
+		}
+	}
+
+	void Reset();
+
+	int32 Num() const { return NumOps; }
+
+private:
+	struct FEntityOps
+	{
+		TArray<Worker_RemoveComponentOp> Ops;
+		Worker_EntityId PrevEntityId;
+		Worker_EntityId NextEntityId;
+	};
+
+	TMap<Worker_EntityId_Key, FEntityOps> OpsByEntity;
+	Worker_EntityId FirstEntityId = SpatialConstants::INVALID_ENTITY_ID;
+	Worker_EntityId LastEntityId = SpatialConstants::INVALID_ENTITY_ID;
+	int32 NumOps = 0;
+};
@@ -21,7 +21,8 @@ struct FPendingRPCParams
 	FUnrealObjectRef ObjectRef;
 	SpatialGDK::RPCPayload Payload;
 
-	FDateTime QueuedTimestamp;
+	// FPlatformTime::Seconds() at the time the RPC was queued
+	double QueuedTimestamp;
 };
 
 class FRPCContainer
@@ -30,6 +31,7 @@ public:
 	void QueueRPC(FPendingRPCParamsPtr Params, ESchemaComponentType Type);
 	void ProcessRPCs(const FProcessRPCDelegate& FunctionToApply);
 	bool ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, ESchemaComponentType Type) const;
+	int32 GetNumQueuedRPCs() const { return NumQueuedRPCs; }
 
 private:
 	using FArrayOfParams = TArray<FPendingRPCParamsPtr>;
@@ -40,4 +42,5 @@ private:
 	static bool ApplyFunction(const FProcessRPCDelegate& FunctionToApply, const FPendingRPCParams& Params);
 
 	RPCContainerType QueuedRPCs;
+	int32 NumQueuedRPCs = 0;
 };
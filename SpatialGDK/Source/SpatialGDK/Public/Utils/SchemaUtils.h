@@ -12,6 +12,7 @@
 #include <WorkerSDK/improbable/c_worker.h>
 
 using StringToEntityMap = TMap<FString, Worker_EntityId>;
+using ComponentIdToEntityMap = TMap<Worker_ComponentId, Worker_EntityId>;
 
 namespace SpatialGDK
 {
@@ -165,6 +166,31 @@ inline void AddStringToEntityMapToSchema(Schema_Object* Object, Schema_FieldId I
 	}
 }
 
+inline void AddComponentIdToEntityMapToSchema(Schema_Object* Object, Schema_FieldId Id, const ComponentIdToEntityMap& Map)
+{
+	for (const auto& Pair : Map)
+	{
+		Schema_Object* PairObject = Schema_AddObject(Object, Id);
+		Schema_AddUint32(PairObject, SCHEMA_MAP_KEY_FIELD_ID, Pair.Key);
+		Schema_AddEntityId(PairObject, SCHEMA_MAP_VALUE_FIELD_ID, Pair.Value);
+	}
+}
+
+inline ComponentIdToEntityMap GetComponentIdToEntityMapFromSchema(Schema_Object* Object, Schema_FieldId Id)
+{
+	ComponentIdToEntityMap Map;
+
+	int32 MapCount = (int32)Schema_GetObjectCount(Object, Id);
+	Map.Reserve(MapCount);
+	for (int32 i = 0; i < MapCount; i++)
+	{
+		Schema_Object* PairObject = Schema_IndexObject(Object, Id, i);
+		Map.Add(Schema_GetUint32(PairObject, SCHEMA_MAP_KEY_FIELD_ID), Schema_GetEntityId(PairObject, SCHEMA_MAP_VALUE_FIELD_ID));
+	}
+
+	return Map;
+}
+
 inline StringToEntityMap GetStringToEntityMapFromSchema(Schema_Object* Object, Schema_FieldId Id)
 {
 	StringToEntityMap Map;
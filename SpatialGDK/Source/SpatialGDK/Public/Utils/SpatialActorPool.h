@@ -0,0 +1,66 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Interface.h"
+
+#include "SpatialActorPool.generated.h"
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class USpatialPooledActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+// Optional hooks for Actor classes pooled through USpatialGDKSettings::ActorPoolSizes.
+// Pooled Actors only get BeginPlay and EndPlay once, so per entity state should be reset through these instead.
+class SPATIALGDK_API ISpatialPooledActor
+{
+	GENERATED_BODY()
+
+public:
+	// Called after the Actor left view and was deactivated.
+	virtual void OnReturnedToPool() {}
+
+	// Called when the Actor is reused for a newly checked out entity, before its initial replicated state is applied.
+	virtual void OnTakenFromPool() {}
+};
+
+// Keeps Actors that left a client's view around, deactivated, to reuse for the next entity of the same class
+// that comes into view, instead of destroying and spawning them each time.
+class SPATIALGDK_API FSpatialActorPool
+{
+public:
+	void Init();
+
+	bool IsPooledClass(UClass* Class) const;
+
+	// Returns nullptr if there is no pooled Actor of exactly this class.
+	AActor* Acquire(UClass* Class, const FTransform& Transform);
+
+	// Returns false if the class isn't pooled or its pool is full, in which case the Actor should be destroyed as usual.
+	bool Release(AActor* Actor);
+
+	int32 GetNumPooledActors() const { return NumPooledActors; }
+
+private:
+	struct FPooledActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+		bool bWasHidden;
+		bool bHadCollision;
+		bool bWasTicking;
+	};
+
+	struct FClassPool
+	{
+		int32 MaxSize = 0;
+		TArray<FPooledActor> Actors;
+	};
+
+	// Only exact class matches are pooled, subclasses can have different components to reset.
+	TMap<TSoftClassPtr<AActor>, FClassPool> ClassPools;
+	int32 NumPooledActors = 0;
+};
@@ -0,0 +1,140 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+#include <string>
+
+namespace SpatialGDK
+{
+struct SpatialMetrics;
+}
+
+// Every counter the GDK reports to SpatialOS. USpatialMetrics sends them with the rest of the worker metrics every
+// MetricsReportRate seconds, and "SpatialDumpMetrics" logs their current values.
+//
+// Metric catalogue (name sent to SpatialOS, unit, what it measures):
+//   Interop.Ops.<Type>PerSecond              ops/s    Ops of each type received from SpatialOS and dispatched.
+//   Interop.ComponentUpdatesSentPerSecond    updates/s  Component updates queued on the worker connection.
+//   Interop.ComponentUpdateBytesPerSecond    bytes/s  Serialized size of those component updates, only with bEnableComponentUpdateSizeMetrics.
+//   Interop.EntityCreationsInFlight          entities Create entity requests sent without a response yet.
+//   Interop.UnresolvedRefsPending            objects  Objects waiting on unresolved object references to apply properties.
+//   Interop.IncomingRPCsQueued               RPCs     Received RPCs waiting on unresolved references.
+//   Interop.OutgoingRPCsQueued               RPCs     RPCs waiting to be sent until their target is ready.
+//   Interop.ActorPool.HitsPerSecond          actors/s Checked out entities that reused a pooled Actor, only with ActorPoolSizes.
+//   Interop.ActorPool.MissesPerSecond        actors/s Checked out entities of a pooled class that had to spawn a new Actor.
+//   Interop.ActorPool.Size                   actors   Actors currently kept in the pool.
+//   Interop.PlayerSpawner.LoginsPerSecond    players/s  Players accepted by this server.
+//   Interop.PlayerSpawner.QueuedLogins       players  Players admitted by this server's spawner and waiting to be accepted.
+//   Interop.EntitiesAwaitingClassLoad        entities Checked out entities not spawned until their class loads, only with bAsyncLoadNewActorClasses.
+//   Interop.EntitiesAwaitingSpawn            entities Checked out entities queued behind the client spawn budget, only with ClientEntitySpawnBudgetMs.
+//   Interop.OutgoingQueue.<Lane>.Depth       messages Messages queued in each outgoing lane for the ops thread to hand to the Worker SDK.
+//   Interop.OutgoingQueue.<Lane>.MaxLatencyUs  us     Longest a message in each outgoing lane waited to be sent since the last report.
+//   Interop.ComponentUpdateBytes             histogram, bytes  Serialized size of each component update sent, only with bEnableComponentUpdateSizeMetrics.
+//   Interop.ReplicationTimeMs                histogram, ms     Time spent in ServerReplicateActors per tick.
+//   RPC.Function.<Class>::<Function>.*       see USpatialMetrics::TrackSentRPC, only with bEnableRPCMetrics.
+enum class ESpatialCounter : uint8
+{
+	OpsAddEntity,
+	OpsRemoveEntity,
+	OpsAddComponent,
+	OpsRemoveComponent,
+	OpsAuthorityChange,
+	OpsComponentUpdate,
+	OpsCommandRequest,
+	OpsCommandResponse,
+	OpsOther,
+	ComponentUpdatesSent,
+	ComponentUpdateBytesSent,
+	ActorPoolHits,
+	ActorPoolMisses,
+	ActorPoolSize,
+	PlayerLoginsAccepted,
+	PlayerLoginsQueued,
+	EntityCreationsInFlight,
+	UnresolvedRefsPending,
+	IncomingRPCsQueued,
+	OutgoingRPCsQueued,
+	EntitiesAwaitingClassLoad,
+	EntitiesAwaitingSpawn,
+	OutgoingControlQueueDepth,
+	OutgoingReplicationQueueDepth,
+	OutgoingBulkQueueDepth,
+	OutgoingDiagnosticsQueueDepth,
+	OutgoingControlQueueMaxLatency,
+	OutgoingReplicationQueueMaxLatency,
+	OutgoingBulkQueueMaxLatency,
+	OutgoingDiagnosticsQueueMaxLatency,
+	Count
+};
+
+enum class ESpatialCounterKind : uint8
+{
+	// Accumulated between reports and reported per second.
+	Rate,
+	// Set to the current value, reported as is.
+	Gauge
+};
+
+struct FSpatialCounterInfo
+{
+	const TCHAR* Key;
+	ESpatialCounterKind Kind;
+};
+
+// Histogram with power of two bucket bounds starting at a fixed base, so recording a sample is a single
+// log2 and never allocates. The last bucket catches everything above the largest bound.
+struct SPATIALGDK_API FSpatialMetricHistogram
+{
+	static const int32 NUM_BUCKETS = 8;
+
+	void Record(double Value, double BaseBound);
+	void AddTo(SpatialGDK::SpatialMetrics& OutMetrics, const std::string& Key, double BaseBound) const;
+	void Reset();
+
+	uint32 Samples[NUM_BUCKETS] = {};
+	uint32 NumSamples = 0;
+	double Sum = 0.0;
+};
+
+// Counters bumped by the interop classes as they work. Only touched from the game thread.
+class SPATIALGDK_API FSpatialCounters
+{
+public:
+	FSpatialCounters();
+
+	static const FSpatialCounterInfo& GetCounterInfo(ESpatialCounter Counter);
+	static ESpatialCounter GetOpCounter(Worker_OpType OpType);
+
+	FORCEINLINE void Increment(ESpatialCounter Counter, int64 Amount = 1) { Values[static_cast<int32>(Counter)] += Amount; }
+	FORCEINLINE void Set(ESpatialCounter Counter, int64 Value) { Values[static_cast<int32>(Counter)] = Value; }
+	FORCEINLINE int64 Get(ESpatialCounter Counter) const { return Values[static_cast<int32>(Counter)]; }
+
+	void RecordComponentUpdateSent(Worker_ComponentId ComponentId);
+	void RecordComponentUpdateBytesSent(Worker_ComponentId ComponentId, uint32 Bytes);
+	void RecordReplicationTime(double Milliseconds);
+
+	// Adds every counter and histogram to OutMetrics and starts the next report period.
+	void AddTo(SpatialGDK::SpatialMetrics& OutMetrics, float SecondsSinceLastReport);
+
+	void Dump(FOutputDevice& Ar) const;
+
+private:
+	struct FComponentUpdateStats
+	{
+		uint64 Updates = 0;
+		uint64 Bytes = 0;
+	};
+
+	int64 Values[static_cast<int32>(ESpatialCounter::Count)];
+	std::string Keys[static_cast<int32>(ESpatialCounter::Count)];
+
+	FSpatialMetricHistogram ComponentUpdateBytes;
+	FSpatialMetricHistogram ReplicationTimeMs;
+
+	// Totals since the counters were created, only shown by Dump.
+	TMap<Worker_ComponentId, FComponentUpdateStats> ComponentUpdateStats;
+};
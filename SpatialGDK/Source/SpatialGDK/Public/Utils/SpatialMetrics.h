@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 
 #include "SpatialConstants.h"
+#include "Utils/SpatialCounters.h"
+#include "Utils/WorkerLoadEstimator.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -14,6 +16,8 @@
 struct Schema_Object;
 class USpatialNetDriver;
 class USpatialWorkerConnection;
+struct FPackedRPCStats;
+struct FPendingRPCParams;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialMetrics, Log, All);
 
@@ -32,6 +36,8 @@ public:
 	double GetAverageFPS() const { return AverageFPS; }
 	double GetWorkerLoad() const { return WorkerLoad; }
 
+	FWorkerLoadEstimator& GetLoadEstimator() { return LoadEstimator; }
+
 	UFUNCTION(Exec)
 	void SpatialStartRPCMetrics();
 	void OnStartRPCMetricsCommand();
@@ -40,11 +46,16 @@ public:
 	void SpatialStopRPCMetrics();
 	void OnStopRPCMetricsCommand();
 
+	// Logs every counter in FSpatialCounters along with the last reported FPS and load.
+	UFUNCTION(Exec)
+	void SpatialDumpMetrics();
+
 	UFUNCTION(Exec)
 	void SpatialModifySetting(const FString& Name, float Value);
 	void OnModifySettingCommand(Schema_Object* CommandPayload);
 
-	void TrackSentRPC(UFunction* Function, ESchemaComponentType RPCType, int PayloadSize);
+	void TrackSentRPC(UFunction* Function, ESchemaComponentType RPCType, const FPendingRPCParams& Params, uint32 SendStartCycles);
+	void TrackPackedRPCFlush(const FPackedRPCStats& Stats);
 
 private:
 	UPROPERTY()
@@ -58,18 +69,49 @@ private:
 	double AverageFPS;
 	double WorkerLoad;
 
-	// RPC tracking is activated with "SpatialStartRPCMetrics" and stopped with "SpatialStopRPCMetrics"
-	// console command. It will record every sent RPC as well as the size of its payload, and then display
-	// tracked data upon stopping. Calling these console commands on the client will also start/stop RPC
-	// tracking on the server.
-	struct RPCStat
+	FWorkerLoadEstimator LoadEstimator;
+
+	// Packed RPC totals accumulated since the last report, reported as per-frame averages.
+	uint32 PackedRPCUpdatesSinceLastReport;
+	uint32 PackedRPCsSinceLastReport;
+	uint32 PackedRPCBytesSinceLastReport;
+	uint32 UnpackedSingleRPCsSinceLastReport;
+
+	// Per sent UFunction. Names and metric keys are only built the first time a function is sent.
+	struct FRPCFunctionStats
 	{
 		ESchemaComponentType Type;
 		FString Name;
-		int Calls;
-		int TotalPayload;
+
+		std::string CallsKey;
+		std::string PayloadBytesKey;
+		std::string QueueDelayKey;
+		std::string SendLatencyKey;
+
+		// Accumulated between "SpatialStartRPCMetrics" and "SpatialStopRPCMetrics".
+		int TrackedCalls;
+		int TrackedPayload;
+
+		// Accumulated since the last report, only when bEnableRPCMetrics is set.
+		uint32 CallsSinceLastReport;
+		FSpatialMetricHistogram PayloadBytes;
+		FSpatialMetricHistogram QueueDelayMs;
+		FSpatialMetricHistogram SendLatencyUs;
 	};
-	TMap<FString, RPCStat> RecentRPCs;
+
+	void SampleCounters();
+
+	FRPCFunctionStats& FindOrAddRPCFunctionStats(UFunction* Function, ESchemaComponentType RPCType);
+	void AddRPCFunctionMetrics(SpatialGDK::SpatialMetrics& OutMetrics);
+
+	// Indices into RPCFunctionStats. RPC UFunctions live as long as their class, so the raw pointer is only used as a key.
+	TMap<const UFunction*, int32> RPCFunctionStatsIndices;
+	TArray<FRPCFunctionStats> RPCFunctionStats;
+
+	// RPC tracking is activated with "SpatialStartRPCMetrics" and stopped with "SpatialStopRPCMetrics"
+	// console command. It will record every sent RPC as well as the size of its payload, and then display
+	// tracked data upon stopping. Calling these console commands on the client will also start/stop RPC
+	// tracking on the server.
 	bool bRPCTrackingEnabled;
 	float RPCTrackingStartTime;
 };
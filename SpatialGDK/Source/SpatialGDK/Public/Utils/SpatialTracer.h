@@ -0,0 +1,97 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialTracer, Log, All);
+
+// Every traced scope. The names written to trace files come from GetEventName, so only append to this list.
+enum class ESpatialTraceEvent : uint16
+{
+	ProcessOps,
+	OpAddEntity,
+	OpRemoveEntity,
+	OpAddComponent,
+	OpRemoveComponent,
+	OpAuthorityChange,
+	OpComponentUpdate,
+	OpCommandRequest,
+	OpCommandResponse,
+	OpOther,
+	ReplicateActor,
+	SerializeComponentData,
+	SerializeComponentUpdate,
+	OpsThreadReceive,
+	OpsThreadSend,
+	OpsThreadDecode,
+	Count
+};
+
+// Records begin/end events into a ring buffer per thread while enabled, and writes them all out to a compact
+// binary file when stopped, which can then be converted to Chrome trace format (chrome://tracing).
+// When disabled, a traced scope costs a single relaxed load.
+//
+// Console commands, which can also be passed to dedicated servers with -ExecCmds:
+//   Spatial.Trace.Start
+//   Spatial.Trace.Stop [Path]                          Defaults to Saved/Profiling/SpatialTrace-<timestamp>.sptrace
+//   Spatial.Trace.ConvertToChrome <InPath> [OutPath]   Defaults to InPath with a .json extension
+class SPATIALGDK_API FSpatialTracer
+{
+public:
+	static FORCEINLINE bool IsEnabled() { return bEnabled; }
+
+	static void Start();
+	static bool Stop(const FString& Path);
+
+	static bool ConvertToChromeTrace(const FString& InPath, const FString& OutPath);
+
+	static const TCHAR* GetEventName(ESpatialTraceEvent Event);
+	static ESpatialTraceEvent GetOpEvent(Worker_OpType OpType);
+
+	static void RecordBegin(ESpatialTraceEvent Event, Worker_EntityId EntityId, Worker_ComponentId ComponentId);
+	static void RecordEnd(ESpatialTraceEvent Event, Worker_EntityId EntityId, Worker_ComponentId ComponentId, uint32 Bytes);
+
+private:
+	static volatile bool bEnabled;
+};
+
+class FSpatialTraceScope
+{
+public:
+	FORCEINLINE FSpatialTraceScope(ESpatialTraceEvent InEvent, Worker_EntityId InEntityId = 0, Worker_ComponentId InComponentId = 0)
+		: Event(InEvent)
+		, EntityId(InEntityId)
+		, ComponentId(InComponentId)
+		, Bytes(0)
+		, bActive(FSpatialTracer::IsEnabled())
+	{
+		if (bActive)
+		{
+			FSpatialTracer::RecordBegin(Event, EntityId, ComponentId);
+		}
+	}
+
+	FORCEINLINE ~FSpatialTraceScope()
+	{
+		if (bActive)
+		{
+			FSpatialTracer::RecordEnd(Event, EntityId, ComponentId, Bytes);
+		}
+	}
+
+	// Only worth computing extra data for the end event when this is true.
+	FORCEINLINE bool IsActive() const { return bActive; }
+
+	FORCEINLINE void SetEntityId(Worker_EntityId InEntityId) { EntityId = InEntityId; }
+	FORCEINLINE void SetBytes(uint32 InBytes) { Bytes = InBytes; }
+
+private:
+	ESpatialTraceEvent Event;
+	Worker_EntityId EntityId;
+	Worker_ComponentId ComponentId;
+	uint32 Bytes;
+	bool bActive;
+};
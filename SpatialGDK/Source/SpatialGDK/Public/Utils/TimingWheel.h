@@ -0,0 +1,81 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+
+class FTimingWheel;
+
+struct FTimingWheelHandle
+{
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Invalidate() { Index = INDEX_NONE; }
+
+private:
+	friend class FTimingWheel;
+
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+};
+
+// Hierarchical timing wheel for the GDK's internal timers (heartbeats, RPC retries, entity range expiration).
+// Timers are bucketed into slots of TICK_INTERVAL_SECONDS in the lowest level and cascaded down from coarser
+// levels as time advances, so arming, re-arming and clearing a timer are all O(1) regardless of how many are active.
+class SPATIALGDK_API FTimingWheel
+{
+public:
+	FTimingWheel();
+
+	// Arms the timer referenced by InOutHandle, re-arming it in place if it's still active.
+	void SetTimer(FTimingWheelHandle& InOutHandle, TFunction<void()>&& Callback, float DelaySeconds, bool bLoop = false, float FirstDelaySeconds = -1.0f);
+
+	// Pushes back the expiry of an active timer, keeping its callback. Returns false if the timer is no longer active.
+	bool ResetTimer(const FTimingWheelHandle& Handle, float DelaySeconds);
+
+	void ClearTimer(FTimingWheelHandle& InOutHandle);
+	bool IsTimerActive(const FTimingWheelHandle& Handle) const;
+
+	void Tick(float DeltaTime);
+
+	int32 GetNumActiveTimers() const { return NumActiveTimers; }
+
+	static constexpr float TICK_INTERVAL_SECONDS = 0.01f;
+
+private:
+	struct FTimer
+	{
+		TSharedPtr<TFunction<void()>> Callback;
+		uint64 ExpiryTick = 0;
+		uint64 IntervalTicks = 0; // Non-zero for looping timers
+		uint32 Generation = 0;
+		int32 Slot = INDEX_NONE;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+		bool bActive = false;
+	};
+
+	uint64 SecondsToTicks(float Seconds) const;
+
+	FTimer* GetActiveTimer(const FTimingWheelHandle& Handle);
+	const FTimer* GetActiveTimer(const FTimingWheelHandle& Handle) const;
+
+	int32 AllocateTimer();
+	void FreeTimer(int32 Index);
+
+	void LinkTimer(int32 Index);
+	void UnlinkTimer(int32 Index);
+	int32 PopSlot(int32 Slot);
+
+	void AdvanceOneTick();
+	void Cascade(int32 Level);
+
+	TArray<FTimer> Timers;
+	TArray<int32> FreeTimerIndices;
+	TArray<int32> SlotHeads;
+
+	uint64 CurrentTick;
+	float AccumulatedSeconds;
+	int32 NumActiveTimers;
+};
@@ -0,0 +1,44 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Estimates worker load from the time the game thread and the ops thread actually spend working, rather than from
+// raw frame time, which also counts idle sleeps, vsync waits and tick rate throttling as load.
+// Game thread time is split into replication, receiving ops and everything else (gameplay), each weighted by
+// the LoadEstimate*Weight settings. 1.0 means the busiest thread is using all of its time.
+class SPATIALGDK_API FWorkerLoadEstimator
+{
+public:
+	struct FLoadBreakdown
+	{
+		// Fractions of the game thread time available at the target tick rate.
+		double Replication = 0.0;
+		double Receive = 0.0;
+		double Gameplay = 0.0;
+		// Weighted sum of the above.
+		double GameThread = 0.0;
+		// Fraction of wall time the ops thread was not sleeping.
+		double OpsThread = 0.0;
+		// Smoothed maximum of the game thread and ops thread load.
+		double Load = 0.0;
+	};
+
+	void AddFrame(double FrameSeconds, double IdleSeconds);
+	void AddReplicationTime(double Seconds) { ReplicationSeconds += Seconds; }
+	void AddReceiveTime(double Seconds) { ReceiveSeconds += Seconds; }
+
+	// Computes the load over everything recorded since the last call, then starts a new period.
+	const FLoadBreakdown& Update(double TargetFrameSeconds, double PeriodSeconds, double OpsThreadBusySeconds);
+	const FLoadBreakdown& GetLastBreakdown() const { return LastBreakdown; }
+
+private:
+	double BusySeconds = 0.0;
+	double ReplicationSeconds = 0.0;
+	double ReceiveSeconds = 0.0;
+	int32 Frames = 0;
+
+	bool bHasSmoothedLoad = false;
+	FLoadBreakdown LastBreakdown;
+};
@@ -32,10 +32,36 @@ using namespace SpatialGDK;
 
 DEFINE_LOG_CATEGORY(LogSpatialGDKSnapshot);
 
-bool CreateSpawnerEntity(Worker_SnapshotOutputStream* OutputStream)
+// Puts each spawner shard in the middle of a different cell of the server workers' rectangle grid, so the load balancer
+// assigns them to different servers. Shards wrap around if there are more of them than cells.
+Coordinates GetSpawnerShardPosition(int32 ShardIndex)
+{
+	const FSpatialLaunchConfigDescription& LaunchConfig = GetDefault<USpatialGDKEditorSettings>()->LaunchConfigDesc;
+	const FWorkerTypeLaunchSection* ServerWorkers = LaunchConfig.ServerWorkers.FindByPredicate([](const FWorkerTypeLaunchSection& Section)
+	{
+		return Section.WorkerTypeName == SpatialConstants::DefaultServerWorkerType;
+	});
+
+	if (ServerWorkers == nullptr || ServerWorkers->Columns * ServerWorkers->Rows <= 1)
+	{
+		return Origin;
+	}
+
+	const int32 Cell = ShardIndex % (ServerWorkers->Columns * ServerWorkers->Rows);
+	const double CellWidth = static_cast<double>(LaunchConfig.World.Dimensions.X) / ServerWorkers->Columns;
+	const double CellDepth = static_cast<double>(LaunchConfig.World.Dimensions.Y) / ServerWorkers->Rows;
+
+	Coordinates Position;
+	Position.X = -0.5 * LaunchConfig.World.Dimensions.X + (Cell % ServerWorkers->Columns + 0.5) * CellWidth;
+	Position.Y = 0.0;
+	Position.Z = -0.5 * LaunchConfig.World.Dimensions.Y + (Cell / ServerWorkers->Columns + 0.5) * CellDepth;
+	return Position;
+}
+
+bool CreateSpawnerEntity(Worker_SnapshotOutputStream* OutputStream, Worker_EntityId EntityId, const Coordinates& SpawnerPosition)
 {
 	Worker_Entity SpawnerEntity;
-	SpawnerEntity.entity_id = SpatialConstants::INITIAL_SPAWNER_ENTITY_ID;
+	SpawnerEntity.entity_id = EntityId;
 
 	Worker_ComponentData PlayerSpawnerData = {};
 	PlayerSpawnerData.component_id = SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID;
@@ -50,7 +76,7 @@ bool CreateSpawnerEntity(Worker_SnapshotOutputStream* OutputStream)
 	ComponentWriteAcl.Add(SpatialConstants::ENTITY_ACL_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
 	ComponentWriteAcl.Add(SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
 
-	Components.Add(Position(Origin).CreatePositionData());
+	Components.Add(Position(SpawnerPosition).CreatePositionData());
 	Components.Add(Metadata(TEXT("SpatialSpawner")).CreateMetadataData());
 	Components.Add(Persistence().CreatePersistenceData());
 	Components.Add(EntityAcl(SpatialConstants::ClientOrServerPermission, ComponentWriteAcl).CreateEntityAclData());
@@ -64,14 +90,14 @@ bool CreateSpawnerEntity(Worker_SnapshotOutputStream* OutputStream)
 
 Worker_ComponentData CreateSingletonManagerData()
 {
-	StringToEntityMap SingletonNameToEntityId;
+	ComponentIdToEntityMap SingletonClassIdToEntityId;
 
 	Worker_ComponentData Data{};
 	Data.component_id = SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID;
 	Data.schema_type = Schema_CreateComponentData(SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID);
 	Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
 
-	AddStringToEntityMapToSchema(ComponentObject, 1, SingletonNameToEntityId);
+	AddComponentIdToEntityMapToSchema(ComponentObject, SpatialConstants::SINGLETON_MANAGER_SINGLETON_CLASS_ID_TO_ENTITY_ID, SingletonClassIdToEntityId);
 
 	return Data;
 }
@@ -194,7 +220,7 @@ bool RunUserSnapshotGenerationOverrides(Worker_SnapshotOutputStream* OutputStrea
 
 bool FillSnapshot(Worker_SnapshotOutputStream* OutputStream, UWorld* World)
 {
-	if (!CreateSpawnerEntity(OutputStream))
+	if (!CreateSpawnerEntity(OutputStream, SpatialConstants::INITIAL_SPAWNER_ENTITY_ID, GetSpawnerShardPosition(0)))
 	{
 		UE_LOG(LogSpatialGDKSnapshot, Error, TEXT("Error generating Spawner in snapshot: %s"), UTF8_TO_TCHAR(Worker_SnapshotOutputStream_GetError(OutputStream)));
 		return false;
@@ -207,6 +233,16 @@ bool FillSnapshot(Worker_SnapshotOutputStream* OutputStream, UWorld* World)
 	}
 
 	Worker_EntityId NextAvailableEntityID = SpatialConstants::FIRST_AVAILABLE_ENTITY_ID;
+
+	// Additional player spawner shards, the first one always keeps its well known entity ID.
+	for (int32 ShardIndex = 1; ShardIndex < GetDefault<USpatialGDKSettings>()->PlayerSpawnerShardCount; ShardIndex++)
+	{
+		if (!CreateSpawnerEntity(OutputStream, NextAvailableEntityID++, GetSpawnerShardPosition(ShardIndex)))
+		{
+			UE_LOG(LogSpatialGDKSnapshot, Error, TEXT("Error generating Spawner shard %d in snapshot: %s"), ShardIndex, UTF8_TO_TCHAR(Worker_SnapshotOutputStream_GetError(OutputStream)));
+			return false;
+		}
+	}
 	if (!RunUserSnapshotGenerationOverrides(OutputStream, NextAvailableEntityID))
 	{
 		UE_LOG(LogSpatialGDKSnapshot, Error, TEXT("Error running user defined snapshot generation overrides in snapshot: %s"), UTF8_TO_TCHAR(Worker_SnapshotOutputStream_GetError(OutputStream)));